@@ -0,0 +1,82 @@
+/**
+ * Compares messages per second delivered to an MBot through a pipe with:
+ *   - MBotDriver::spin, which blocks in a Poller between frames
+ *   - MBotDriver::spin_async, which suspends a coroutine on a Scheduler
+ *
+ * A writer thread sends framed drive commands and closes the pipe, which
+ * ends the spin.
+ */
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "mbot/mbot_base.hpp"
+#include "mbot_driver/mbot_driver.hpp"
+#include "rix/ipc/event.hpp"
+#include "rix/ipc/pipe.hpp"
+#include "rix/msg/geometry/Twist2DStamped.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::ipc;
+using namespace rix::msg;
+
+constexpr size_t NUM_MESSAGES = 200000;
+
+class CountingMBot : public MBotBase {
+   public:
+    CountingMBot(size_t &count) : count_(count) {}
+    bool ok() const override { return true; }
+    void drive(const Twist2DStamped &) const override { count_++; }
+
+   private:
+    size_t &count_;
+};
+
+std::vector<uint8_t> make_frame() {
+    geometry::Twist2DStamped cmd;
+    cmd.header.frame_id = "mbot";
+    cmd.twist.vx = 0.25f;
+
+    standard::UInt32 length;
+    length.data = cmd.size();
+    std::vector<uint8_t> frame(length.size() + length.data);
+    size_t offset = 0;
+    length.serialize(frame.data(), offset);
+    cmd.serialize(frame.data(), offset);
+    return frame;
+}
+
+template <typename SpinFn>
+void run(const std::string &name, SpinFn spin) {
+    auto [reader, writer] = Pipe::create();
+    const auto frame = make_frame();
+
+    size_t received = 0;
+    MBotDriver driver(std::make_unique<Pipe>(std::move(reader)), std::make_unique<CountingMBot>(received));
+
+    rix::util::Timer timer;
+    timer.start();
+    std::thread producer([&writer, &frame]() {
+        for (size_t i = 0; i < NUM_MESSAGES; i++) {
+            writer.write(frame.data(), frame.size());
+        }
+        writer = Pipe();
+    });
+    spin(driver);
+    producer.join();
+    timer.stop();
+
+    // The final stop command is not counted
+    received--;
+    double seconds = timer.get().to_nanoseconds() / 1e9;
+    std::cout << name << ": " << static_cast<size_t>(received / seconds) << " msg/s (" << received << " messages in "
+              << seconds << " s)" << std::endl;
+}
+
+int main() {
+    run("MBotDriver::spin      ", [](MBotDriver &driver) { driver.spin(std::make_unique<Event>()); });
+    run("MBotDriver::spin_async", [](MBotDriver &driver) { driver.spin_async(std::make_unique<Event>()); });
+    return 0;
+}
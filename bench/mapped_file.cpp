@@ -0,0 +1,106 @@
+/**
+ * Compares the throughput of scanning a recording of framed drive commands
+ * with:
+ *   - File::read through a BufferedReader, copying each frame out of a buffer
+ *   - MappedFile, deserializing each frame in place
+ *
+ * Both deserialize every command so that only the access path differs.
+ */
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <iostream>
+#include <vector>
+
+#include "rix/ipc/buffered_reader.hpp"
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/mapped_file.hpp"
+#include "rix/msg/geometry/Twist2DStamped.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::ipc;
+using namespace rix::msg;
+
+constexpr size_t NUM_MESSAGES = 2000000;
+constexpr int NUM_RUNS = 5;
+const std::string PATH = "/tmp/mapped_file_bench.bin";
+
+void make_recording() {
+    geometry::Twist2DStamped cmd;
+    cmd.header.frame_id = "mbot";
+    cmd.twist.vx = 0.25f;
+
+    standard::UInt32 length;
+    length.data = cmd.size();
+    std::vector<uint8_t> frame(length.size() + length.data);
+    size_t offset = 0;
+    length.serialize(frame.data(), offset);
+    cmd.serialize(frame.data(), offset);
+
+    std::vector<uint8_t> chunk;
+    for (size_t i = 0; i < 1024; i++) {
+        chunk.insert(chunk.end(), frame.begin(), frame.end());
+    }
+
+    File out(PATH, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    for (size_t i = 0; i < NUM_MESSAGES / 1024; i++) {
+        out.write(chunk.data(), chunk.size());
+    }
+}
+
+template <typename ScanFn>
+void run(const std::string &name, ScanFn scan) {
+    double best = 0;
+    size_t bytes = 0, messages = 0;
+    for (int i = 0; i < NUM_RUNS; i++) {
+        rix::util::Timer timer;
+        timer.start();
+        messages = scan(bytes);
+        timer.stop();
+        double seconds = timer.get().to_nanoseconds() / 1e9;
+        best = std::max(best, bytes / seconds);
+    }
+    std::cout << name << ": " << static_cast<size_t>(best / 1e6) << " MB/s (" << messages << " messages, "
+              << bytes << " bytes, best of " << NUM_RUNS << ")" << std::endl;
+}
+
+int main() {
+    make_recording();
+
+    run("File::read + BufferedReader", [](size_t &bytes) {
+        File in(PATH, O_RDONLY);
+        BufferedReader reader(in);
+        std::vector<uint8_t> frame;
+        size_t messages = 0;
+        bytes = 0;
+        ssize_t n;
+        while ((n = reader.read_frame(frame)) > 0) {
+            geometry::Twist2DStamped cmd;
+            size_t offset = 0;
+            cmd.deserialize(frame.data(), frame.size(), offset);
+            bytes += n;
+            messages++;
+        }
+        return messages;
+    });
+
+    run("MappedFile                 ", [](size_t &bytes) {
+        MappedFile in(PATH, MappedFile::Advice::SEQUENTIAL);
+        auto span = in.span();
+        size_t messages = 0, offset = 0;
+        while (offset < span.size()) {
+            standard::UInt32 length;
+            geometry::Twist2DStamped cmd;
+            if (!length.deserialize(span.data(), span.size(), offset) ||
+                !cmd.deserialize(span.data(), offset + length.data, offset)) {
+                break;
+            }
+            messages++;
+        }
+        bytes = offset;
+        return messages;
+    });
+
+    unlink(PATH.c_str());
+}
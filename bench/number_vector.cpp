@@ -0,0 +1,89 @@
+/**
+ * Compares float vector serialize + deserialize throughput from 1K to 1M
+ * elements with:
+ *   - per-element helpers, one memcpy and one bounds check per element and
+ *     push_back on deserialize
+ *   - bulk helpers, one bounds check, resize and a single copy
+ *   - bulk helpers with a big-endian wire, adding a vectorized byte swap
+ */
+#include <iostream>
+#include <vector>
+
+#include "rix/msg/serialization.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::msg::detail;
+
+constexpr size_t TOTAL_ELEMENTS = 200000000;
+
+void serialize_elements(uint8_t *dst, size_t &offset, const std::vector<float> &src) {
+    uint32_t len = src.size();
+    serialize_number(dst, offset, len);
+    for (const auto &v : src)
+        serialize_number(dst, offset, v);
+}
+
+bool deserialize_elements(std::vector<float> &dst, const uint8_t *src, size_t size, size_t &offset) {
+    uint32_t len;
+    if (!deserialize_number(len, src, size, offset))
+        return false;
+    dst.clear();
+    dst.reserve(len);
+    for (uint32_t i = 0; i < len; ++i) {
+        float v;
+        if (!deserialize_number(v, src, size, offset))
+            return false;
+        dst.push_back(v);
+    }
+    return true;
+}
+
+template <typename RoundTripFn>
+void run(const std::string &name, size_t n, RoundTripFn round_trip) {
+    std::vector<float> input(n);
+    for (size_t i = 0; i < n; i++) {
+        input[i] = static_cast<float>(i);
+    }
+    std::vector<uint8_t> buffer(size_number_vector(input));
+    std::vector<float> output;
+
+    size_t iterations = TOTAL_ELEMENTS / n;
+    rix::util::Timer timer;
+    timer.start();
+    for (size_t i = 0; i < iterations; i++) {
+        round_trip(input, buffer, output);
+    }
+    timer.stop();
+
+    if (output != input) {
+        std::cout << name << ": round trip mismatch" << std::endl;
+        return;
+    }
+    double seconds = timer.get().to_nanoseconds() / 1e9;
+    double bytes = 2.0 * iterations * n * sizeof(float);
+    std::cout << name << " n=" << n << ": " << bytes / seconds / 1e9 << " GB/s" << std::endl;
+}
+
+int main() {
+    for (size_t n : {1000, 10000, 100000, 1000000}) {
+        run("per-element    ", n, [](const std::vector<float> &in, std::vector<uint8_t> &buffer, std::vector<float> &out) {
+            size_t offset = 0;
+            serialize_elements(buffer.data(), offset, in);
+            offset = 0;
+            deserialize_elements(out, buffer.data(), buffer.size(), offset);
+        });
+        run("bulk           ", n, [](const std::vector<float> &in, std::vector<uint8_t> &buffer, std::vector<float> &out) {
+            size_t offset = 0;
+            serialize_number_vector(buffer.data(), offset, in);
+            offset = 0;
+            deserialize_number_vector(out, buffer.data(), buffer.size(), offset);
+        });
+        run("bulk big-endian", n, [](const std::vector<float> &in, std::vector<uint8_t> &buffer, std::vector<float> &out) {
+            size_t offset = 0;
+            serialize_number_vector<std::endian::big>(buffer.data(), offset, in);
+            offset = 0;
+            deserialize_number_vector<std::endian::big>(out, buffer.data(), buffer.size(), offset);
+        });
+    }
+    return 0;
+}
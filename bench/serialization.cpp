@@ -0,0 +1,103 @@
+/**
+ * Compares Twist2DStamped round trips (serialize then deserialize) per second
+ * with:
+ *   - per-field helpers, one bounds check and one memcpy per number
+ *   - packed helpers, one bounds check and one block copy for each of the
+ *     stamp and twist, as in the Time and Twist2D messages
+ *   - Twist2DStamped::serialize/deserialize, which adds the virtual calls of
+ *     the nested messages
+ */
+#include <iostream>
+#include <vector>
+
+#include "rix/msg/geometry/Twist2DStamped.hpp"
+#include "rix/msg/serialization.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::msg;
+using namespace rix::msg::detail;
+
+constexpr size_t NUM_ROUND_TRIPS = 10000000;
+
+void serialize_fields(uint8_t *dst, size_t &offset, const geometry::Twist2DStamped &src) {
+    serialize_number(dst, offset, src.header.seq);
+    serialize_number(dst, offset, src.header.stamp.sec);
+    serialize_number(dst, offset, src.header.stamp.nsec);
+    serialize_string(dst, offset, src.header.frame_id);
+    serialize_number(dst, offset, src.twist.vx);
+    serialize_number(dst, offset, src.twist.vy);
+    serialize_number(dst, offset, src.twist.wz);
+}
+
+bool deserialize_fields(geometry::Twist2DStamped &dst, const uint8_t *src, size_t size, size_t &offset) {
+    return deserialize_number(dst.header.seq, src, size, offset) &&
+           deserialize_number(dst.header.stamp.sec, src, size, offset) &&
+           deserialize_number(dst.header.stamp.nsec, src, size, offset) &&
+           deserialize_string(dst.header.frame_id, src, size, offset) &&
+           deserialize_number(dst.twist.vx, src, size, offset) && deserialize_number(dst.twist.vy, src, size, offset) &&
+           deserialize_number(dst.twist.wz, src, size, offset);
+}
+
+void serialize_packed(uint8_t *dst, size_t &offset, const geometry::Twist2DStamped &src) {
+    serialize_number(dst, offset, src.header.seq);
+    serialize_numbers(dst, offset, src.header.stamp.sec, src.header.stamp.nsec);
+    serialize_string(dst, offset, src.header.frame_id);
+    serialize_numbers(dst, offset, src.twist.vx, src.twist.vy, src.twist.wz);
+}
+
+bool deserialize_packed(geometry::Twist2DStamped &dst, const uint8_t *src, size_t size, size_t &offset) {
+    return deserialize_number(dst.header.seq, src, size, offset) &&
+           deserialize_numbers(src, size, offset, dst.header.stamp.sec, dst.header.stamp.nsec) &&
+           deserialize_string(dst.header.frame_id, src, size, offset) &&
+           deserialize_numbers(src, size, offset, dst.twist.vx, dst.twist.vy, dst.twist.wz);
+}
+
+template <typename RoundTripFn>
+void run(const std::string &name, RoundTripFn round_trip) {
+    geometry::Twist2DStamped cmd;
+    cmd.header.frame_id = "mbot";
+    std::vector<uint8_t> buffer(cmd.size());
+    geometry::Twist2DStamped out;
+
+    float checksum = 0;
+    rix::util::Timer timer;
+    timer.start();
+    for (size_t i = 0; i < NUM_ROUND_TRIPS; i++) {
+        cmd.header.seq = i;
+        cmd.twist.vx = static_cast<float>(i);
+        round_trip(cmd, buffer, out);
+        checksum += out.twist.vx;
+    }
+    timer.stop();
+
+    double seconds = timer.get().to_nanoseconds() / 1e9;
+    std::cout << name << ": " << static_cast<size_t>(NUM_ROUND_TRIPS / seconds) << " round trips/s ("
+              << seconds * 1e9 / NUM_ROUND_TRIPS << " ns each, checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+    run("per-field helpers ", [](const geometry::Twist2DStamped &cmd, std::vector<uint8_t> &buffer,
+                                 geometry::Twist2DStamped &out) {
+        size_t offset = 0;
+        serialize_fields(buffer.data(), offset, cmd);
+        offset = 0;
+        deserialize_fields(out, buffer.data(), buffer.size(), offset);
+    });
+
+    run("packed helpers    ", [](const geometry::Twist2DStamped &cmd, std::vector<uint8_t> &buffer,
+                                 geometry::Twist2DStamped &out) {
+        size_t offset = 0;
+        serialize_packed(buffer.data(), offset, cmd);
+        offset = 0;
+        deserialize_packed(out, buffer.data(), buffer.size(), offset);
+    });
+
+    run("Twist2DStamped    ", [](const geometry::Twist2DStamped &cmd, std::vector<uint8_t> &buffer,
+                                 geometry::Twist2DStamped &out) {
+        size_t offset = 0;
+        cmd.serialize(buffer.data(), offset);
+        offset = 0;
+        out.deserialize(buffer.data(), buffer.size(), offset);
+    });
+    return 0;
+}
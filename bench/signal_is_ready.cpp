@@ -0,0 +1,48 @@
+/**
+ * Compares the cost of polling a Signal that has not been received with:
+ *   - Signal::wait(Duration(0)), the previous is_ready path (poll + read)
+ *   - Signal::is_ready, which checks the pending counter first
+ *
+ * Both loops are also run with a signal raised every 1000 checks to show that
+ * received signals are still consumed.
+ */
+#include <signal.h>
+
+#include <iostream>
+
+#include "rix/ipc/signal.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::ipc;
+
+constexpr size_t NUM_CHECKS = 1000000;
+constexpr size_t RAISE_PERIOD = 1000;
+
+template <typename CheckFn>
+void run(const std::string &name, const Signal &sig, bool raise, CheckFn check) {
+    size_t received = 0;
+    rix::util::Timer timer;
+    timer.start();
+    for (size_t i = 0; i < NUM_CHECKS; i++) {
+        if (raise && i % RAISE_PERIOD == 0) {
+            sig.raise();
+        }
+        received += check(sig);
+    }
+    timer.stop();
+
+    double ns = static_cast<double>(timer.get().to_nanoseconds()) / NUM_CHECKS;
+    std::cout << name << ": " << ns << " ns/check (" << received << " signals received)" << std::endl;
+}
+
+int main() {
+    Signal sig(SIGUSR1);
+
+    auto wait_zero = [](const Signal &s) { return s.wait(rix::util::Duration(0)); };
+    auto is_ready = [](const Signal &s) { return s.is_ready(); };
+
+    run("wait(Duration(0))          ", sig, false, wait_zero);
+    run("is_ready()                 ", sig, false, is_ready);
+    run("wait(Duration(0)) + raises ", sig, true, wait_zero);
+    run("is_ready() + raises        ", sig, true, is_ready);
+}
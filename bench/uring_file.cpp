@@ -0,0 +1,99 @@
+/**
+ * Compares messages per second written through a pipe with:
+ *   - File::write, one syscall per framed message
+ *   - UringFile::write, one ring submission per framed message
+ *   - UringFile::queue_write + flush, one ring submission per batch
+ *   - UringFile fallback (queue depth 0), one writev per batch
+ *
+ * A reader thread drains the pipe with a BufferedReader and counts frames.
+ */
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "rix/ipc/buffered_reader.hpp"
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/uring_file.hpp"
+#include "rix/msg/geometry/Twist2DStamped.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+#include "rix/util/time.hpp"
+
+using namespace rix::ipc;
+using namespace rix::msg;
+
+constexpr size_t NUM_MESSAGES = 200000;
+constexpr size_t BATCH_SIZE = 32;
+
+std::vector<uint8_t> make_frame() {
+    geometry::Twist2DStamped cmd;
+    cmd.header.frame_id = "mbot";
+    cmd.twist.vx = 0.25f;
+
+    standard::UInt32 length;
+    length.data = cmd.size();
+    std::vector<uint8_t> frame(length.size() + length.data);
+    size_t offset = 0;
+    length.serialize(frame.data(), offset);
+    cmd.serialize(frame.data(), offset);
+    return frame;
+}
+
+template <typename WriteFn>
+void run(const std::string &name, WriteFn write_all) {
+    auto [reader, writer] = Pipe::create();
+
+    size_t received = 0;
+    std::thread consumer([&reader, &received]() {
+        BufferedReader buffered(reader);
+        std::vector<uint8_t> frame;
+        while (buffered.read_frame(frame) > 0) {
+            received++;
+        }
+    });
+
+    rix::util::Timer timer;
+    timer.start();
+    write_all(writer);
+    writer = Pipe();
+    consumer.join();
+    timer.stop();
+
+    double seconds = timer.get().to_nanoseconds() / 1e9;
+    std::cout << name << ": " << static_cast<size_t>(received / seconds) << " msg/s (" << received << " messages in "
+              << seconds << " s)" << std::endl;
+}
+
+int main() {
+    const auto frame = make_frame();
+
+    run("File::write          ", [&frame](Pipe &writer) {
+        for (size_t i = 0; i < NUM_MESSAGES; i++) {
+            writer.write(frame.data(), frame.size());
+        }
+    });
+
+    run("UringFile::write     ", [&frame](Pipe &writer) {
+        UringFile out(::dup(writer.fd()));
+        if (!out.is_uring()) std::cout << "(io_uring unavailable, using fallback) ";
+        for (size_t i = 0; i < NUM_MESSAGES; i++) {
+            out.write(frame.data(), frame.size());
+        }
+    });
+
+    run("UringFile batched    ", [&frame](Pipe &writer) {
+        UringFile out(::dup(writer.fd()), BATCH_SIZE);
+        for (size_t i = 0; i < NUM_MESSAGES; i++) {
+            out.queue_write(frame.data(), frame.size());
+        }
+        out.flush();
+    });
+
+    run("UringFile fallback   ", [&frame](Pipe &writer) {
+        UringFile out(::dup(writer.fd()), 0);
+        for (size_t i = 0; i < NUM_MESSAGES; i++) {
+            out.queue_write(frame.data(), frame.size());
+            if (out.queued() == BATCH_SIZE) out.flush();
+        }
+        out.flush();
+    });
+}
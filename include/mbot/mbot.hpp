@@ -13,7 +13,10 @@
 
 #include "mbot/messages.hpp"
 #include "mbot/mbot_base.hpp"
+#include "rix/ipc/event.hpp"
 #include "rix/ipc/file.hpp"
+#include "rix/ipc/poller.hpp"
+#include "rix/ipc/timer_fd.hpp"
 #include "rix/msg/geometry/Twist2DStamped.hpp"
 
 using rix::msg::geometry::Twist2DStamped;
@@ -31,6 +34,6 @@ class MBot : public MBotBase {
 
     mutable std::mutex mtx;
     std::thread timesync_thr;
-    std::atomic<bool> stop_timesync_flag;
+    rix::ipc::Event stop_timesync;
     rix::ipc::File file;
 };
\ No newline at end of file
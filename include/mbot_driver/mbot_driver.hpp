@@ -4,10 +4,14 @@
 
 #include "mbot/mbot.hpp"
 #include "mbot/mbot_base.hpp"
+#include "rix/ipc/coro.hpp"
 #include "rix/ipc/file.hpp"
 #include "rix/ipc/interfaces/io.hpp"
 #include "rix/ipc/interfaces/notification.hpp"
+#include "rix/ipc/sequence_filter.hpp"
 #include "rix/ipc/signal.hpp"
+#include "rix/ipc/udp_socket.hpp"
+#include "rix/ipc/unix_socket.hpp"
 #include "rix/msg/geometry/Twist2DStamped.hpp"
 #include "rix/msg/standard/UInt32.hpp"
 
@@ -19,7 +23,68 @@ class MBotDriver {
     MBotDriver(std::unique_ptr<interfaces::IO> input, std::unique_ptr<MBotBase> mbot);
     void spin(std::unique_ptr<interfaces::Notification> notif);
 
+    /**
+     * @brief Same as `spin`, but reads commands and waits for `notif` in two
+     * coroutines on a single-threaded `coro::Scheduler`.
+     *
+     * @param notif The notification that stops the driver
+     */
+    void spin_async(std::unique_ptr<interfaces::Notification> notif);
+
+    /**
+     * @brief Drives the MBot in fixed cycles. The commands read during a cycle
+     * are coalesced, and the newest one is applied when the cycle's deadline
+     * is reached, so a burst of queued commands costs one drive. Deadlines are
+     * absolute, so the schedule does not drift. A stop command is sent at end
+     * of input or when `notif` is ready, which ends the loop.
+     *
+     * @param notif The notification that stops the driver
+     * @param cycle The cycle period, which must be finite and positive
+     */
+    void spin(std::unique_ptr<interfaces::Notification> notif, const rix::util::Duration &cycle);
+
+    /**
+     * @brief Returns the number of cycle deadlines missed by the cycled
+     * `spin`, because reading or driving took longer than a whole cycle.
+     *
+     */
+    size_t overruns() const;
+
+    /**
+     * @brief Serves any number of clients connected to `listener` from one
+     * thread, instead of reading the input. Each message from a client is one
+     * length-prefixed drive command. A stop command is sent when the last
+     * client disconnects and when `notif` is ready, which ends the loop.
+     *
+     * @param listener The listening socket that clients connect to
+     * @param notif The notification that stops the driver
+     */
+    void serve(const UnixListener &listener, std::unique_ptr<interfaces::Notification> notif);
+
+    /**
+     * @brief Drives the MBot with commands received on `socket`, instead of
+     * reading the input. Each datagram is one length-prefixed drive command,
+     * and commands older than the newest one applied, by `header.seq`, are
+     * dropped. A stop command is sent when `notif` is ready, which ends the
+     * loop.
+     *
+     * @param socket The bound socket that commands are sent to
+     * @param notif The notification that stops the driver
+     * @return size_t The number of stale commands that were dropped
+     */
+    size_t serve(const UdpSocket &socket, std::unique_ptr<interfaces::Notification> notif);
+
    private:
+    /**
+     * @brief Drives the MBot with the length-prefixed command in `frame`.
+     * Returns `false` if the frame is malformed or, when a `filter` is given,
+     * if the command is stale.
+     */
+    bool drive_frame(const std::vector<uint8_t> &frame, SequenceFilter *filter = nullptr);
+
+    coro::Task<void> drive_commands(coro::Scheduler &scheduler);
+
     std::unique_ptr<interfaces::IO> input;
     std::unique_ptr<MBotBase> mbot;
+    size_t overruns_;
 };
\ No newline at end of file
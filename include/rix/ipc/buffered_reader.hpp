@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include "rix/ipc/interfaces/io.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class BufferedReader
+ * @brief Ring buffer over an `interfaces::IO` object that extracts whole
+ * length-prefixed frames. Each frame on the wire is a serialized
+ * `standard::UInt32` length followed by that many bytes of payload. The reader
+ * fills its buffer with as few large reads as possible and keeps partially
+ * received frames across calls, so short reads never cause a loss of sync.
+ *
+ */
+class BufferedReader {
+   public:
+    /**
+     * @brief Size of the length prefix preceding every frame.
+     *
+     */
+    static constexpr size_t PREFIX_SIZE = msg::static_size_v<msg::standard::UInt32>;
+
+    /**
+     * @brief Construct a new BufferedReader. The reader does not take ownership
+     * of `io`, which must outlive the reader.
+     *
+     * @param io The underlying IO object to read from
+     * @param capacity The size of the ring buffer in bytes. This bounds the
+     * largest frame that can be received to `capacity - PREFIX_SIZE` bytes.
+     */
+    BufferedReader(const interfaces::IO &io, size_t capacity = 65536);
+
+    /**
+     * @brief Copy constructor is deleted because two readers must not consume
+     * the same stream.
+     */
+    BufferedReader(const BufferedReader &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because two readers must not
+     * consume the same stream.
+     */
+    BufferedReader &operator=(const BufferedReader &other) = delete;
+
+    /**
+     * @brief Performs a single read from the underlying IO object into the free
+     * space of the ring buffer. If the free space wraps around the end of the
+     * buffer, both regions are filled with one scatter read. Bytes that belong
+     * to a rejected oversized frame are discarded as they arrive.
+     *
+     * @return ssize_t The number of bytes read, 0 on end of file, or -1 on
+     * error (including a full buffer).
+     */
+    ssize_t fill();
+
+    /**
+     * @brief Returns `true` if a whole frame is buffered and `next_frame` will
+     * succeed without reading from the underlying IO object.
+     *
+     */
+    bool has_frame() const;
+
+    /**
+     * @brief Extracts the next whole frame from the buffer without performing
+     * any IO. The payload (without the length prefix) is copied into `frame`.
+     * If the announced frame length cannot fit in the buffer, the frame is
+     * discarded, `errno` is set to `EMSGSIZE`, and the rest of its payload is
+     * skipped by later calls to `fill`.
+     *
+     * @param frame The destination for the frame payload
+     * @return true if a frame was extracted, false if no whole frame is
+     * buffered.
+     */
+    bool next_frame(std::vector<uint8_t> &frame);
+
+    /**
+     * @brief Returns the next frame, filling the buffer from the underlying IO
+     * object until a whole frame is available. Partially received frames are
+     * kept in the buffer if the IO object reports an error or would block.
+     *
+     * @param frame The destination for the frame payload
+     * @return ssize_t The number of bytes consumed from the stream (length
+     * prefix plus payload), 0 on end of file, or -1 on error. If the announced
+     * frame length cannot fit in the buffer, the frame is discarded, `errno`
+     * is set to `EMSGSIZE` and -1 is returned. The rest of its payload is
+     * skipped as it arrives, so the next call returns the frame after it.
+     */
+    ssize_t read_frame(std::vector<uint8_t> &frame);
+
+    /**
+     * @brief Returns the number of buffered bytes that have not been consumed.
+     *
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the capacity of the ring buffer in bytes.
+     *
+     */
+    size_t capacity() const;
+
+    /**
+     * @brief Discards all buffered data, and stops skipping the rest of an
+     * oversized frame.
+     *
+     */
+    void clear();
+
+   private:
+    /**
+     * @brief Copies `len` buffered bytes starting at the read position into
+     * `dst` without consuming them.
+     */
+    void peek(uint8_t *dst, size_t len) const;
+
+    /**
+     * @brief Advances the read position by `len` bytes.
+     */
+    void consume(size_t len);
+
+    /**
+     * @brief Discards the frame at the read position if it can never fit in
+     * the buffer, and skips the rest of its payload as it arrives. Returns
+     * true if a frame was discarded.
+     */
+    bool discard_oversized();
+
+    /**
+     * @brief Returns the total size (prefix plus payload) of the frame at the
+     * read position, or 0 if the length prefix has not been received yet.
+     */
+    size_t pending_frame_size() const;
+
+    const interfaces::IO &io_;
+    std::vector<uint8_t> buffer_;
+    size_t head_; /**< Index of the first unconsumed byte */
+    size_t size_; /**< Number of unconsumed bytes */
+    size_t skip_; /**< Bytes of a rejected oversized frame not received yet */
+};
+
+}  // namespace ipc
+}  // namespace rix
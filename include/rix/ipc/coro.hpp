@@ -0,0 +1,387 @@
+#pragma once
+
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "rix/ipc/interfaces/io.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+#include "rix/ipc/poller.hpp"
+#include "rix/util/time.hpp"
+
+namespace rix {
+namespace ipc {
+namespace coro {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+/**
+ * @brief State shared by the promises of all Task types. A Task starts
+ * suspended and, when it finishes, resumes the coroutine that awaited it.
+ *
+ */
+struct PromiseBase {
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) const noexcept {
+            std::coroutine_handle<> continuation = handle.promise().continuation;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void unhandled_exception() { exception = std::current_exception(); }
+
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+};
+
+template <typename T>
+struct Promise : PromiseBase {
+    Task<T> get_return_object();
+    void return_value(T value) { result = std::move(value); }
+
+    T get() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        return std::move(*result);
+    }
+
+    std::optional<T> result;
+};
+
+template <>
+struct Promise<void> : PromiseBase {
+    Task<void> get_return_object();
+    void return_void() {}
+
+    void get() {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * @class Task
+ * @brief Lazily started coroutine that produces a value of type `T`. A Task
+ * runs when it is awaited with `co_await` or spawned on a `Scheduler`, and
+ * owns its coroutine frame. Exceptions thrown by the coroutine are rethrown
+ * to the awaiter.
+ *
+ */
+template <typename T>
+class Task {
+   public:
+    using promise_type = detail::Promise<T>;
+
+    /**
+     * @brief Default constructor. The Task has no coroutine.
+     *
+     */
+    Task() : handle_(nullptr) {}
+
+    explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {}
+
+    Task(const Task &other) = delete;
+    Task &operator=(const Task &other) = delete;
+
+    Task(Task &&other) : handle_(std::exchange(other.handle_, nullptr)) {}
+
+    Task &operator=(Task &&other) {
+        if (this != &other) {
+            if (handle_) {
+                handle_.destroy();
+            }
+            handle_ = std::exchange(other.handle_, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor. Destroys the coroutine frame, even if the coroutine
+     * has not finished.
+     *
+     */
+    ~Task() {
+        if (handle_) {
+            handle_.destroy();
+        }
+    }
+
+    /**
+     * @brief Returns true if the Task has a coroutine that has finished.
+     *
+     */
+    bool done() const { return handle_ && handle_.done(); }
+
+    /**
+     * @brief Returns the result of a finished Task, rethrowing the exception
+     * that ended it, if any.
+     *
+     */
+    T result() { return handle_.promise().get(); }
+
+    bool await_ready() const noexcept { return !handle_ || handle_.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiter) noexcept {
+        handle_.promise().continuation = awaiter;
+        return handle_;
+    }
+
+    T await_resume() { return handle_.promise().get(); }
+
+   private:
+    friend class Scheduler;
+
+    std::coroutine_handle<promise_type> handle_;
+};
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() {
+    return Task<T>(std::coroutine_handle<Promise<T>>::from_promise(*this));
+}
+
+inline Task<void> Promise<void>::get_return_object() {
+    return Task<void>(std::coroutine_handle<Promise<void>>::from_promise(*this));
+}
+
+}  // namespace detail
+
+/**
+ * @class Scheduler
+ * @brief Single-threaded event loop that runs coroutines. Coroutines suspend
+ * on file descriptors, which are watched with a `Poller`, and on timers, and
+ * are resumed by `run` on the calling thread, so state shared between them
+ * needs no locks. At most one coroutine may wait for a descriptor to become
+ * readable, and one for it to become writable, at a time.
+ *
+ */
+class Scheduler {
+   public:
+    /**
+     * @brief Construct a new Scheduler. On failure, `ok` returns false.
+     *
+     */
+    Scheduler();
+
+    /**
+     * @brief Destructor. Destroys the spawned coroutines that have not
+     * finished.
+     *
+     */
+    ~Scheduler();
+
+    Scheduler(const Scheduler &other) = delete;
+    Scheduler &operator=(const Scheduler &other) = delete;
+
+    /**
+     * @brief Returns the Scheduler whose `run` is executing on this thread, or
+     * `nullptr` outside of `run`.
+     *
+     */
+    static Scheduler *current();
+
+    /**
+     * @brief Takes ownership of `task` and starts it on the next iteration of
+     * `run`.
+     *
+     */
+    void spawn(Task<void> task);
+
+    /**
+     * @brief Resumes coroutines as their descriptors become ready and their
+     * timers expire, until every spawned Task has finished, `stop` is called,
+     * or no coroutine can make progress. An exception that ends a spawned
+     * Task is rethrown from `run`.
+     *
+     */
+    void run();
+
+    /**
+     * @brief Makes `run` return once the coroutine that is running suspends.
+     * Unfinished coroutines stay suspended and can be resumed by calling `run`
+     * again.
+     *
+     */
+    void stop();
+
+    /**
+     * @brief Returns the number of spawned Tasks that have not finished.
+     *
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns true if the Scheduler is valid.
+     *
+     */
+    bool ok() const;
+
+    /**
+     * @brief Resumes `handle` when `fd` reports one of `events`, a hangup or
+     * an error.
+     *
+     * @return true if `handle` was registered, false if the descriptor cannot
+     * be polled or already has a waiter for the same event.
+     */
+    bool wait_for(int fd, uint32_t events, std::coroutine_handle<> handle);
+
+    /**
+     * @brief Resumes `handle` once `deadline` has passed.
+     *
+     */
+    void wake_at(const rix::util::Time &deadline, std::coroutine_handle<> handle);
+
+   private:
+    struct Waiters {
+        std::coroutine_handle<> reader;
+        std::coroutine_handle<> writer;
+    };
+
+    struct Timer {
+        rix::util::Time deadline;
+        uint64_t sequence;
+        std::coroutine_handle<> handle;
+
+        bool operator>(const Timer &other) const {
+            return deadline > other.deadline || (deadline == other.deadline && sequence > other.sequence);
+        }
+    };
+
+    void dispatch(const Poller::Event &event);
+    void update(int fd);
+    void reap();
+
+    Poller poller_;
+    std::unordered_map<int, Waiters> waiters_;
+    std::priority_queue<Timer, std::vector<Timer>, std::greater<Timer>> timers_;
+    std::deque<std::coroutine_handle<>> ready_;
+    std::vector<Task<void>> tasks_;
+    uint64_t sequence_;
+    bool stopped_;
+};
+
+/**
+ * @brief Awaitable that suspends the coroutine until a file descriptor is
+ * ready. Outside of a Scheduler, or if the descriptor cannot be polled, it
+ * does not suspend, and the IO that follows blocks as usual.
+ *
+ */
+class FdAwaiter {
+   public:
+    FdAwaiter(int fd, uint32_t events) : fd_(fd), events_(events) {}
+
+    bool await_ready() const noexcept { return fd_ < 0 || Scheduler::current() == nullptr; }
+
+    bool await_suspend(std::coroutine_handle<> handle) const {
+        return Scheduler::current()->wait_for(fd_, events_, handle);
+    }
+
+    void await_resume() const noexcept {}
+
+   private:
+    int fd_;
+    uint32_t events_;
+};
+
+/**
+ * @brief Awaitable that suspends the coroutine until a deadline. Outside of a
+ * Scheduler, it sleeps the thread instead.
+ *
+ */
+class SleepAwaiter {
+   public:
+    explicit SleepAwaiter(const rix::util::Time &deadline) : deadline_(deadline) {}
+
+    bool await_ready() const;
+
+    void await_suspend(std::coroutine_handle<> handle) const { Scheduler::current()->wake_at(deadline_, handle); }
+
+    void await_resume() const noexcept {}
+
+   private:
+    rix::util::Time deadline_;
+};
+
+/**
+ * @brief Suspends until `io` is readable.
+ *
+ */
+inline FdAwaiter readable(const interfaces::IO &io) { return FdAwaiter(io.fd(), Poller::READABLE); }
+
+/**
+ * @brief Suspends until `fd` is readable.
+ *
+ */
+inline FdAwaiter readable(int fd) { return FdAwaiter(fd, Poller::READABLE); }
+
+/**
+ * @brief Suspends until `io` is writable.
+ *
+ */
+inline FdAwaiter writable(const interfaces::IO &io) { return FdAwaiter(io.fd(), Poller::WRITABLE); }
+
+/**
+ * @brief Suspends until `fd` is writable.
+ *
+ */
+inline FdAwaiter writable(int fd) { return FdAwaiter(fd, Poller::WRITABLE); }
+
+/**
+ * @brief Suspends for `d`.
+ *
+ */
+inline SleepAwaiter sleep_for(const rix::util::Duration &d) { return SleepAwaiter(rix::util::Time::monotonic_now() + d); }
+
+/**
+ * @brief Suspends until `deadline`, a time on `Time::monotonic_now`.
+ *
+ */
+inline SleepAwaiter sleep_until(const rix::util::Time &deadline) { return SleepAwaiter(deadline); }
+
+/**
+ * @brief Waits until `io` is readable, then reads up to `size` bytes.
+ *
+ * @return ssize_t The result of `io.read`
+ */
+Task<ssize_t> async_read(const interfaces::IO &io, uint8_t *buffer, size_t size);
+
+/**
+ * @brief Waits until `io` is writable, then writes up to `size` bytes.
+ *
+ * @return ssize_t The result of `io.write`
+ */
+Task<ssize_t> async_write(const interfaces::IO &io, const uint8_t *buffer, size_t size);
+
+/**
+ * @brief Waits until `notif` is ready and consumes it. A notification that
+ * cannot be polled is checked with `is_ready` once per millisecond.
+ *
+ * @return true once the notification has been consumed
+ */
+Task<bool> async_wait(const interfaces::Notification &notif);
+
+}  // namespace coro
+}  // namespace ipc
+}  // namespace rix
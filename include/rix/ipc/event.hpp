@@ -0,0 +1,123 @@
+#pragma once
+
+#include <sys/eventfd.h>
+
+#include <cstdint>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class Event
+ * @brief Notification backed by an eventfd counter, used to wake another
+ * thread (or a forked process sharing the fd) without a pipe or a signal.
+ * `raise` adds to the counter and `wait` consumes it. The Event is pollable,
+ * so it can be registered with a `Poller` next to `File` objects.
+ *
+ */
+class Event : public interfaces::Notification {
+   public:
+    /**
+     * @brief COUNTER: a successful wait consumes the whole counter.
+     * SEMAPHORE: a successful wait decrements the counter by one.
+     *
+     */
+    enum class Mode : int { COUNTER, SEMAPHORE };
+
+    /**
+     * @brief Creates a new eventfd. If the eventfd cannot be created, the
+     * Event is put in an invalid state (`ok` returns false).
+     *
+     * @param mode The consumption mode
+     * @param initial The initial value of the counter
+     */
+    Event(Mode mode = Mode::COUNTER, uint32_t initial = 0);
+
+    /**
+     * @brief Copy constructor. This will duplicate the underlying eventfd
+     * using `dup`, so both Events share the same counter.
+     *
+     */
+    Event(const Event &other) = default;
+
+    /**
+     * @brief Assignment operator. This will duplicate the underlying eventfd
+     * using `dup`, so both Events share the same counter.
+     *
+     */
+    Event &operator=(const Event &other) = default;
+
+    /**
+     * @brief Move constructor. The moved Event is put in an invalid state.
+     *
+     */
+    Event(Event &&other) = default;
+
+    /**
+     * @brief Move assignment operator. The moved Event is put in an invalid
+     * state.
+     *
+     */
+    Event &operator=(Event &&other) = default;
+
+    virtual ~Event() = default;
+
+    /**
+     * @brief Adds 1 to the counter, waking any waiting thread. Returns `false`
+     * if the Event is in an invalid state.
+     *
+     */
+    virtual bool raise() const override;
+
+    /**
+     * @brief Adds `n` to the counter. Returns `false` if the Event is in an
+     * invalid state, if `n` is 0, or if the counter would overflow.
+     *
+     */
+    bool raise(uint64_t n) const;
+
+    /**
+     * @brief Wait until the counter is non-zero, or until the specified
+     * duration elapses, and consume it according to the mode.
+     *
+     * @param d The maximum duration to wait for the Event to be raised.
+     * @return true if the Event was raised within the duration.
+     */
+    virtual bool wait(const rix::util::Duration &d) const override;
+
+    /**
+     * @brief Returns the value consumed by the last successful wait: the whole
+     * counter in COUNTER mode, or 1 in SEMAPHORE mode.
+     *
+     */
+    uint64_t count() const;
+
+    /**
+     * @brief Returns the consumption mode.
+     *
+     */
+    Mode mode() const;
+
+    /**
+     * @brief Returns `true` if the eventfd is valid, `false` otherwise.
+     *
+     */
+    bool ok() const;
+
+    /**
+     * @brief Returns the eventfd, or -1 if the Event is in an invalid state.
+     *
+     */
+    virtual int fd() const override;
+
+   private:
+    File file_;
+    Mode mode_;
+    mutable uint64_t count_;
+};
+
+}  // namespace ipc
+}  // namespace rix
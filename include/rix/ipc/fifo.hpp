@@ -7,9 +7,19 @@ namespace ipc {
 
 class Fifo : public File {
    public:
+    /**
+     * @brief WRITE: open the write end, blocking until a reader is present.
+     * READ: open the read end, blocking until a writer is present. Reads
+     * return 0 once every writer has closed.
+     * READ_PERSISTENT: open the read end without blocking and keep an internal
+     * write end open, so writers may attach and detach at any time without
+     * the reader ever seeing end of file. Use a `FifoMonitor` that ignores this
+     * Fifo to be notified of writer attach and detach events.
+     */
     enum class Mode : int {
         WRITE,
-        READ
+        READ,
+        READ_PERSISTENT
     };
 
     /**
@@ -17,11 +27,18 @@ class Fifo : public File {
      * pathname. This will create the fifo special file if it does not exist.
      * The fifo special file will be opened for both reading and writing.
      *  
+     * @details In packet mode, `O_DIRECT` is set on the open file so that each
+     * write of up to `PIPE_BUF` bytes is a separate packet that a single read
+     * returns whole. Packetization is decided by the writer, so the mode only
+     * has an effect on a WRITE Fifo. If the kernel does not support packet
+     * mode for FIFOs, the Fifo remains a byte stream (see `is_packet_mode`).
+     *
      * @param pathname The path to the fifo special file
      * @param mode The mode to open the Fifo with (READ or WRITE)
      * @param nonblocking Flag to toggle non-blocking IO
+     * @param packet Flag to request packet mode
      */
-    Fifo(const std::string &pathname, Mode mode, bool nonblocking=false);
+    Fifo(const std::string &pathname, Mode mode, bool nonblocking=false, bool packet=false);
 
     /**
      * @brief Default constructor. This does not open a file descriptor.
@@ -63,7 +80,8 @@ class Fifo : public File {
     Fifo &operator=(Fifo &&src);
 
     /**
-     * @brief Destructor. This will close the underlying file descriptor.
+     * @brief Destructor. This will close the underlying file descriptor, and
+     * the internal write end in READ_PERSISTENT mode.
      * 
      */
     ~Fifo();
@@ -80,9 +98,21 @@ class Fifo : public File {
      */
     Mode mode() const;
 
+    /**
+     * @brief Returns `true` if writes to this Fifo form packets. Packetization
+     * is a property of the write end, so this is always `false` for a read end.
+     * 
+     */
+    bool is_packet_mode() const;
+
    private:
+    friend class FifoMonitor;
+
+    void close_dummy();
+
     Mode mode_;
     std::string pathname_;
+    int dummy_fd_; /**< Internal write end held open in READ_PERSISTENT mode */
 };
 
 }  // namespace ipc
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <sys/types.h>
+
+#include <string>
+#include <vector>
+
+#include "rix/ipc/fifo.hpp"
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class FifoMonitor
+ * @brief Notification that is ready whenever a writer attaches to or detaches
+ * from a named pipe, using inotify. It is pollable, so a `Fifo` opened in
+ * READ_PERSISTENT mode and its monitor can be waited on together with a
+ * `Poller`.
+ *
+ * @details Events are hints, not an exact account of the writers. inotify
+ * does not report the access mode of an open, so a process opening the FIFO
+ * for reading is also reported as an ATTACH. It also merges identical events
+ * that are queued back to back, so writers that open or close together may
+ * be reported once. Read from the FIFO to learn whether data is flowing. The
+ * descriptors of the reading `Fifo` itself, including the internal write end
+ * of a READ_PERSISTENT Fifo, are excluded with `ignore`.
+ *
+ */
+class FifoMonitor : public interfaces::Notification {
+   public:
+    enum class Event : int { NONE, ATTACH, DETACH };
+
+    /**
+     * @brief Default constructor. Does not monitor a FIFO.
+     *
+     */
+    FifoMonitor();
+
+    /**
+     * @brief Starts monitoring the FIFO specified by `pathname`, which must
+     * exist. Opens that happened before construction are not reported. If the
+     * FIFO cannot be watched, the FifoMonitor is put in an invalid state.
+     *
+     * @param pathname The path to the fifo special file
+     */
+    FifoMonitor(const std::string &pathname);
+
+    /**
+     * @brief Copy constructor is deleted because events are consumed from a
+     * single inotify instance.
+     */
+    FifoMonitor(const FifoMonitor &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because events are consumed from a
+     * single inotify instance.
+     */
+    FifoMonitor &operator=(const FifoMonitor &other) = delete;
+
+    /**
+     * @brief Move constructor. The moved FifoMonitor is put in an invalid
+     * state.
+     *
+     */
+    FifoMonitor(FifoMonitor &&other) = default;
+
+    /**
+     * @brief Move assignment operator. The moved FifoMonitor is put in an
+     * invalid state.
+     *
+     */
+    FifoMonitor &operator=(FifoMonitor &&other) = default;
+
+    virtual ~FifoMonitor() = default;
+
+    /**
+     * @brief Attach and detach events can only be produced by opening and
+     * closing the FIFO, so a FifoMonitor cannot be raised. Always returns
+     * `false`.
+     *
+     */
+    virtual bool raise() const override;
+
+    /**
+     * @brief Wait until a writer attaches or detaches, or until the specified
+     * duration elapses. The event is consumed and available from `event`.
+     *
+     * @param d The maximum duration to wait for an event.
+     * @return true if an event was received within the duration.
+     */
+    virtual bool wait(const rix::util::Duration &d) const override;
+
+    /**
+     * @brief Excludes the descriptors held by `fifo` from events and from the
+     * `writers` count: their closes are consumed without being reported.
+     * `fifo` must have been opened before the monitor was constructed, so
+     * that its opens were never reported.
+     *
+     * @return true if `fifo` was open on the monitored FIFO when the monitor
+     * was constructed.
+     */
+    bool ignore(const Fifo &fifo);
+
+    /**
+     * @brief Returns the last event consumed by `wait`, or NONE.
+     *
+     */
+    Event event() const;
+
+    /**
+     * @brief Returns an estimate of the number of writers that attached and
+     * have not detached since the monitor was created, based on the consumed
+     * events. Readers and merged events make it approximate, and it never
+     * drops below 0.
+     *
+     */
+    int writers() const;
+
+    /**
+     * @brief Returns the pathname of the monitored FIFO.
+     *
+     */
+    std::string pathname() const;
+
+    /**
+     * @brief Returns `true` if the FIFO is being monitored, `false` otherwise.
+     *
+     */
+    bool ok() const;
+
+    /**
+     * @brief Returns the inotify file descriptor, or -1 if the FifoMonitor is
+     * in an invalid state.
+     *
+     */
+    virtual int fd() const override;
+
+   private:
+    /**
+     * @brief Reads and applies one inotify event without blocking. Returns the
+     * resulting event, NONE for events that are not reported, or -1 if no
+     * event is queued.
+     */
+    int next() const;
+
+    File file_;
+    std::string pathname_;
+    dev_t dev_;
+    ino_t ino_;
+    std::vector<int> opened_before_; /**< Descriptors of this process open on the FIFO before the watch */
+    mutable Event event_;
+    mutable int writers_;
+    mutable std::vector<int> ignored_readers_; /**< Read ends of ignored Fifos that have not closed */
+    mutable std::vector<int> ignored_writers_; /**< Write ends of ignored Fifos that have not closed */
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -3,6 +3,7 @@
 #include <fcntl.h>
 #include <poll.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 #include <cstdint>
@@ -10,6 +11,7 @@
 #include <vector>
 
 #include "rix/ipc/interfaces/io.hpp"
+#include "rix/ipc/wait_strategy.hpp"
 
 namespace rix {
 namespace ipc {
@@ -151,12 +153,35 @@ class File : public interfaces::IO {
      */
     virtual ssize_t write(const uint8_t *src, size_t size) const override;
 
+    /**
+     * @brief Scatter read. Fills the `iovcnt` buffers described by `iov` in
+     * order with a single system call.
+     *
+     * @param iov The array of destination buffers
+     * @param iovcnt The number of elements in `iov`
+     * @return ssize_t The total number of bytes actually read, or -1 on error.
+     */
+    virtual ssize_t readv(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Gather write. Writes the `iovcnt` buffers described by `iov` in
+     * order with a single system call. For pipes and FIFOs, a total size of at
+     * most PIPE_BUF bytes is written atomically, so a length prefix and its
+     * message body cannot be interleaved with data from another writer.
+     *
+     * @param iov The array of source buffers
+     * @param iovcnt The number of elements in `iov`
+     * @return ssize_t The total number of bytes actually written, or -1 on
+     * error.
+     */
+    virtual ssize_t writev(const struct iovec *iov, int iovcnt) const override;
+
     /**
      * @brief Get the underlying file descriptor.
      * 
      * @return int The file descriptor
      */
-    int fd() const;
+    virtual int fd() const override;
 
     /**
      * @brief Returns `true` if the file is in a valid state, `false` otherwise.
@@ -164,7 +189,8 @@ class File : public interfaces::IO {
     bool ok() const;
 
     /**
-     * @brief Waits for the specified duration for the file to become readable.
+     * @brief Waits for the specified duration for the file to become readable,
+     * following the wait strategy.
      * 
      * @param duration The maximum duration to wait.
      * @return true if the file has become readable within the duration.
@@ -172,7 +198,8 @@ class File : public interfaces::IO {
     virtual bool wait_for_readable(const util::Duration &duration) const override;
 
     /**
-     * @brief Waits for the specified duration for the file to become writable.
+     * @brief Waits for the specified duration for the file to become writable,
+     * following the wait strategy.
      * 
      * @param duration The maximum duration to wait.
      * @return true if the file has become writable within the duration.
@@ -193,8 +220,63 @@ class File : public interfaces::IO {
      */
     virtual bool is_nonblocking() const override;
 
+    /**
+     * @brief Returns the capacity of the pipe buffer in bytes
+     * (`F_GETPIPE_SZ`), or -1 if the file is not a pipe or FIFO.
+     *
+     */
+    ssize_t capacity() const;
+
+    /**
+     * @brief Sets the capacity of the pipe buffer (`F_SETPIPE_SZ`). The kernel
+     * rounds the capacity up to a power-of-two number of pages. A smaller
+     * buffer bounds how much data, and therefore how much latency, can queue
+     * up in front of a slow reader.
+     *
+     * @param size The requested capacity in bytes
+     * @return ssize_t The actual capacity, or -1 on error (e.g. `EBUSY` if
+     * more data is queued than fits, `EPERM` if `size` exceeds
+     * /proc/sys/fs/pipe-max-size for an unprivileged process).
+     */
+    ssize_t set_capacity(size_t size) const;
+
+    /**
+     * @brief Returns the number of bytes queued and not yet read (`FIONREAD`),
+     * or -1 on error.
+     *
+     */
+    ssize_t bytes_queued() const;
+
+    /**
+     * @brief Sets how `wait_for_readable` and `wait_for_writable` wait. The
+     * strategy and the statistics belong to this object; copies and moved-to
+     * objects start with the default strategy, which blocks immediately.
+     *
+     */
+    void set_wait_strategy(const WaitStrategy &strategy);
+
+    /**
+     * @brief Returns the wait strategy.
+     *
+     */
+    const WaitStrategy &wait_strategy() const;
+
+    /**
+     * @brief Returns how the waits on this file have ended so far.
+     *
+     */
+    const WaitStats &wait_stats() const;
+
+    /**
+     * @brief Clears the wait statistics.
+     *
+     */
+    void reset_wait_stats();
+
    protected:
     int fd_;
+    WaitStrategy wait_strategy_;
+    mutable WaitStats wait_stats_;
 };
 
 }  // namespace ipc
@@ -1,4 +1,6 @@
 #pragma once
+#include <sys/uio.h>
+
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -21,10 +23,37 @@ class IO {
 
     virtual ssize_t read(uint8_t *buffer, size_t len) const = 0;
     virtual ssize_t write(const uint8_t *buffer, size_t len) const = 0;
+    virtual ssize_t readv(const struct iovec *iov, int iovcnt) const = 0;
+    virtual ssize_t writev(const struct iovec *iov, int iovcnt) const = 0;
     virtual bool wait_for_writable(const rix::util::Duration &duration) const = 0;
     virtual bool wait_for_readable(const rix::util::Duration &duration) const = 0;
+
+    /**
+     * @brief Waits until the object is readable or until `deadline`, a time on
+     * `Time::monotonic_now`, passes. The deadline is converted to a single relative timeout on entry, so a
+     * loop that waits repeatedly against one deadline does not drift.
+     * `Time::max()` waits forever.
+     */
+    virtual bool wait_until_readable(const rix::util::Time &deadline) const {
+        return wait_for_readable(deadline.remaining());
+    }
+
+    /**
+     * @brief Waits until the object is writable or until `deadline`, a time on
+     * `Time::monotonic_now`, passes. `Time::max()` waits forever.
+     */
+    virtual bool wait_until_writable(const rix::util::Time &deadline) const {
+        return wait_for_writable(deadline.remaining());
+    }
+
     virtual void set_nonblocking(bool status) = 0;
     virtual bool is_nonblocking() const = 0;
+
+    /**
+     * @brief Returns a file descriptor that can be registered with a `Poller`
+     * to wait for this object, or -1 if the object is not pollable.
+     */
+    virtual int fd() const { return -1; }
 };
 
 }  // namespace interfaces
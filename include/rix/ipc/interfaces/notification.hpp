@@ -16,9 +16,28 @@ class Notification {
     Notification &operator=(const Notification &other) = default;
     virtual ~Notification() = default;
 
-    bool is_ready() const { return wait(rix::util::Duration(0.0)); }
+    /**
+     * @brief Returns `true` and consumes the notification if it is ready,
+     * without blocking. Implementations may override this with a cheaper check
+     * than a zero-duration `wait`.
+     */
+    virtual bool is_ready() const { return wait(rix::util::Duration(0.0)); }
     virtual bool raise() const = 0;
     virtual bool wait(const rix::util::Duration &duration) const = 0;
+
+    /**
+     * @brief Waits until the notification is ready or until `deadline`, a
+     * time on `Time::monotonic_now`, passes, and consumes it if ready.
+     * `Time::max()` waits forever.
+     */
+    virtual bool wait_until(const rix::util::Time &deadline) const { return wait(deadline.remaining()); }
+
+    /**
+     * @brief Returns a file descriptor that becomes readable when the
+     * notification is ready, or -1 if the notification is not pollable. The
+     * notification must still be consumed with `wait` or `is_ready`.
+     */
+    virtual int fd() const { return -1; }
 };
 
 }  // namespace interfaces
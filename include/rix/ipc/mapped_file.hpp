@@ -0,0 +1,139 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "rix/ipc/file.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class MappedFile
+ * @brief Read-only, private memory mapping of a whole file. The contents are
+ * accessed in place through `const uint8_t *` spans, so large recordings can be
+ * scanned and passed to `Message::deserialize` without copying them through
+ * user space buffers. The mapping stays valid after the file it was created
+ * from is closed. The file must not be truncated while it is mapped.
+ *
+ */
+class MappedFile {
+   public:
+    /**
+     * @brief Access pattern hints passed to `madvise`.
+     *
+     */
+    enum class Advice {
+        NORMAL,      ///< No special treatment
+        SEQUENTIAL,  ///< Read ahead aggressively and free pages soon after use
+        RANDOM,      ///< Disable read ahead
+        WILLNEED,    ///< Start reading the range in now
+        DONTNEED     ///< The range will not be accessed soon
+    };
+
+    /**
+     * @brief Default constructor. Does not map anything.
+     *
+     */
+    MappedFile();
+
+    /**
+     * @brief Opens `pathname` read-only and maps it. If opening or mapping
+     * fails, the MappedFile is put in an invalid state. An empty file is valid
+     * and has an empty span.
+     *
+     * @param pathname The path of the file
+     * @param advice The access pattern hint for the whole file
+     */
+    MappedFile(const std::string &pathname, Advice advice = Advice::NORMAL);
+
+    /**
+     * @brief Maps the file open in `file`, which must be readable. The
+     * MappedFile does not take ownership of `file`.
+     *
+     * @param file The open file
+     * @param advice The access pattern hint for the whole file
+     */
+    explicit MappedFile(const File &file, Advice advice = Advice::NORMAL);
+
+    /**
+     * @brief Copy constructor is deleted because a mapping has one owner.
+     */
+    MappedFile(const MappedFile &src) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because a mapping has one owner.
+     */
+    MappedFile &operator=(const MappedFile &src) = delete;
+
+    /**
+     * @brief Move constructor. Moves the mapping to the destination and
+     * invalidates the source.
+     */
+    MappedFile(MappedFile &&src);
+
+    /**
+     * @brief Move assignment operator. Unmaps the destination if valid, then
+     * moves the mapping from the source and invalidates the source.
+     */
+    MappedFile &operator=(MappedFile &&src);
+
+    /**
+     * @brief Destructor. Unmaps the file.
+     *
+     */
+    ~MappedFile();
+
+    /**
+     * @brief Returns a pointer to the first byte of the file, or `nullptr` if
+     * the MappedFile is invalid or empty.
+     *
+     */
+    const uint8_t *data() const;
+
+    /**
+     * @brief Returns the size of the mapped file in bytes.
+     *
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the whole file as a span.
+     *
+     */
+    std::span<const uint8_t> span() const;
+
+    /**
+     * @brief Returns up to `length` bytes starting at `offset`. The span is
+     * shorter than `length` if it would extend past the end of the file, and
+     * empty if `offset` is past the end.
+     *
+     */
+    std::span<const uint8_t> span(size_t offset, size_t length) const;
+
+    /**
+     * @brief Applies an access pattern hint to the bytes from `offset` to the
+     * end of the file, or to `length` bytes if `length` is not 0.
+     *
+     * @return true if successful, false otherwise
+     */
+    bool advise(Advice advice, size_t offset = 0, size_t length = 0) const;
+
+    /**
+     * @brief Returns true if the file was mapped.
+     *
+     */
+    bool ok() const;
+
+   private:
+    void map(const File &file, Advice advice);
+    void unmap();
+
+    uint8_t *data_;
+    size_t size_;
+    bool ok_;
+};
+
+}  // namespace ipc
+}  // namespace rix
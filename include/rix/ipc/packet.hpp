@@ -0,0 +1,96 @@
+#pragma once
+
+#include <limits.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "rix/ipc/interfaces/io.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class PacketWriter
+ * @brief Sends length-prefixed frames over a packet-mode `Pipe` or `Fifo`.
+ * Each frame is a serialized `standard::UInt32` length followed by the
+ * payload, written with a single gather write so that it forms exactly one
+ * packet. The wire format is the same as the one consumed by
+ * `BufferedReader`, so the receiver may also use a byte-stream reader.
+ *
+ */
+class PacketWriter {
+   public:
+    /**
+     * @brief Size of the length prefix preceding every frame.
+     *
+     */
+    static constexpr size_t PREFIX_SIZE = msg::static_size_v<msg::standard::UInt32>;
+
+    /**
+     * @brief Largest frame (prefix plus payload) that is written atomically as
+     * a single packet.
+     *
+     */
+    static constexpr size_t MAX_FRAME_SIZE = PIPE_BUF;
+
+    /**
+     * @brief Construct a new PacketWriter. The writer does not take ownership
+     * of `io`, which must outlive the writer.
+     *
+     * @param io The underlying IO object to write to
+     */
+    PacketWriter(const interfaces::IO &io);
+
+    /**
+     * @brief Writes the length prefix and `size` bytes of payload as one
+     * packet.
+     *
+     * @param payload The frame payload
+     * @param size The size of the payload in bytes
+     * @return ssize_t The number of bytes written (prefix plus payload), or -1
+     * on error. If the frame exceeds `MAX_FRAME_SIZE`, `errno` is set to
+     * `EMSGSIZE` and nothing is written.
+     */
+    ssize_t write_frame(const uint8_t *payload, size_t size) const;
+
+   private:
+    const interfaces::IO &io_;
+};
+
+/**
+ * @class PacketReader
+ * @brief Receives length-prefixed frames from a packet-mode `Pipe` or `Fifo`.
+ * Each frame is received with a single scatter read that places the prefix
+ * and the payload directly in their destinations, so no frame is ever split
+ * across reads or reassembled.
+ *
+ */
+class PacketReader {
+   public:
+    /**
+     * @brief Construct a new PacketReader. The reader does not take ownership
+     * of `io`, which must outlive the reader.
+     *
+     * @param io The underlying IO object to read from
+     */
+    PacketReader(const interfaces::IO &io);
+
+    /**
+     * @brief Reads the next packet and checks that its length prefix matches
+     * the size of the packet.
+     *
+     * @param frame The destination for the frame payload
+     * @return ssize_t The number of bytes in the packet (length prefix plus
+     * payload), 0 on end of file, or -1 on error. If the length prefix does
+     * not match the packet, `errno` is set to `EBADMSG` and -1 is returned.
+     */
+    ssize_t read_frame(std::vector<uint8_t> &frame) const;
+
+   private:
+    const interfaces::IO &io_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -19,9 +19,15 @@ class Pipe : public File {
     * @brief Factory method to create a pair of Pipe objects. The first element
     * is the read-end and the second is the write-end.
     * 
+    * @details In packet mode (`pipe2` with `O_DIRECT`), each write of up to
+    * `PIPE_BUF` bytes is a separate packet, and each read returns at most one
+    * whole packet. Bytes of a packet that do not fit in the read buffer are
+    * discarded.
+    * 
+    * @param packet Flag to create the pipe in packet mode
     * @return std::array<Pipe, 2> The pipe pair
     */
-    static std::array<Pipe, 2> create();
+    static std::array<Pipe, 2> create(bool packet = false);
 
     /**
      * @brief Default constructor. This does not open a file descriptor. The 
@@ -82,6 +88,13 @@ class Pipe : public File {
      */
     bool is_write_end() const;
 
+    /**
+     * @brief Returns `true` if writes to this Pipe form packets. Packetization
+     * is a property of the write end, so this is always `false` for a read end.
+     * 
+     */
+    bool is_packet_mode() const;
+
    private:
     /**
      * @brief Private constructor used by the `create` factory method.
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <sys/epoll.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "rix/ipc/interfaces/io.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+#include "rix/util/time.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class Poller
+ * @brief Reactor built on epoll that multiplexes any number of pollable IO
+ * objects (`File`, `Pipe`, `Fifo`, ...) and Notifications (`Signal`, ...)
+ * behind a single blocking wait. Objects are identified in the ready set by
+ * their file descriptor.
+ *
+ */
+class Poller {
+   public:
+    /**
+     * @brief Event flags that can be requested at registration and that are
+     * reported in the ready set. These may be bitwise or'ed.
+     *
+     */
+    enum Events : uint32_t {
+        READABLE = EPOLLIN,
+        WRITABLE = EPOLLOUT,
+        PRIORITY = EPOLLPRI,
+        HANGUP = EPOLLHUP, /**< Always reported, need not be requested */
+        ERROR = EPOLLERR,  /**< Always reported, need not be requested */
+    };
+
+    /**
+     * @brief Level-triggered registrations are reported by every wait while
+     * the condition holds. Edge-triggered registrations are reported once per
+     * change of state, so the object must be drained (until it would block)
+     * before the next report.
+     *
+     */
+    enum class Trigger { LEVEL, EDGE };
+
+    /**
+     * @brief An element of the ready set.
+     *
+     */
+    struct Event {
+        int fd;          /**< The file descriptor of the ready object */
+        uint32_t events; /**< Bitwise or of the ready `Events` */
+
+        bool readable() const { return events & READABLE; }
+        bool writable() const { return events & WRITABLE; }
+        bool hangup() const { return events & HANGUP; }
+        bool error() const { return events & ERROR; }
+    };
+
+    /**
+     * @brief Construct a new Poller. On failure, `ok` returns false.
+     *
+     */
+    Poller();
+
+    /**
+     * @brief Destructor. Closes the epoll instance. Registered objects are not
+     * closed.
+     *
+     */
+    ~Poller();
+
+    /**
+     * @brief Copy constructor is deleted because a Poller owns its epoll
+     * instance and ready set.
+     */
+    Poller(const Poller &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because a Poller owns its epoll
+     * instance and ready set.
+     */
+    Poller &operator=(const Poller &other) = delete;
+
+    /**
+     * @brief Move constructor. Invalidates the source Poller.
+     *
+     */
+    Poller(Poller &&other);
+
+    /**
+     * @brief Move assignment operator. Closes the destination Poller if valid
+     * and invalidates the source Poller.
+     *
+     */
+    Poller &operator=(Poller &&other);
+
+    /**
+     * @brief Registers an IO object. Fails if the object is not pollable (its
+     * `fd` is -1), or if it is already registered.
+     *
+     * @param io The IO object
+     * @param events The `Events` to wait for
+     * @param trigger Level- or edge-triggered reporting
+     * @return true on success.
+     */
+    bool add(const interfaces::IO &io, uint32_t events = READABLE, Trigger trigger = Trigger::LEVEL);
+
+    /**
+     * @brief Registers a Notification. The Notification is reported as
+     * readable when it is ready, and must then be consumed with `wait` or
+     * `is_ready`. Fails if the Notification is not pollable (its `fd` is -1).
+     *
+     * @param notif The Notification
+     * @param trigger Level- or edge-triggered reporting
+     * @return true on success.
+     */
+    bool add(const interfaces::Notification &notif, Trigger trigger = Trigger::LEVEL);
+
+    /**
+     * @brief Registers a raw file descriptor.
+     *
+     * @param fd The file descriptor
+     * @param events The `Events` to wait for
+     * @param trigger Level- or edge-triggered reporting
+     * @return true on success.
+     */
+    bool add(int fd, uint32_t events, Trigger trigger = Trigger::LEVEL);
+
+    /**
+     * @brief Changes the events and trigger of a registered file descriptor.
+     *
+     * @return true on success.
+     */
+    bool modify(int fd, uint32_t events, Trigger trigger = Trigger::LEVEL);
+
+    /**
+     * @brief Unregisters an IO object.
+     *
+     * @return true on success.
+     */
+    bool remove(const interfaces::IO &io);
+
+    /**
+     * @brief Unregisters a Notification.
+     *
+     * @return true on success.
+     */
+    bool remove(const interfaces::Notification &notif);
+
+    /**
+     * @brief Unregisters a raw file descriptor.
+     *
+     * @return true on success.
+     */
+    bool remove(int fd);
+
+    /**
+     * @brief Blocks until at least one registered object is ready or the
+     * duration elapses. Interrupted waits are resumed with the remaining time.
+     * Sub-millisecond timeouts are rounded up so that they still block.
+     *
+     * @param duration The maximum duration to wait (`Duration::max()` waits
+     * indefinitely).
+     * @return const std::vector<Event>& The ready set, which is empty on
+     * timeout or error. The reference is valid until the next call to `wait`.
+     */
+    const std::vector<Event> &wait(const util::Duration &duration);
+
+    /**
+     * @brief Blocks until at least one registered object is ready or until
+     * `deadline` passes. The deadline is converted to a timeout on entry, and
+     * interrupted waits are resumed against the monotonic clock.
+     *
+     * @param deadline The time on `Time::monotonic_now` to give up at
+     * (`Time::max()` waits indefinitely).
+     * @return const std::vector<Event>& The ready set, which is empty on
+     * timeout or error. The reference is valid until the next call to `wait`.
+     */
+    const std::vector<Event> &wait_until(const util::Time &deadline);
+
+    /**
+     * @brief Returns the number of registered file descriptors.
+     *
+     */
+    size_t size() const;
+
+    /**
+     * @brief Returns the epoll file descriptor.
+     *
+     */
+    int fd() const;
+
+    /**
+     * @brief Returns `true` if the Poller is in a valid state, `false`
+     * otherwise.
+     */
+    bool ok() const;
+
+   private:
+    int epfd_;
+    size_t size_;
+    std::vector<struct epoll_event> events_;
+    std::vector<Event> ready_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstdint>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+#include "rix/ipc/timer_fd.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class QueueSampler
+ * @brief Periodically samples the number of bytes queued in a pipe or FIFO
+ * (`File::bytes_queued`) and tracks the high-water mark. The sampler is a
+ * pollable notification driven by a `TimerFd`: it is ready when a sample at or
+ * above the alert threshold has been taken, so backlog alerts can share an
+ * event loop with the IO they monitor.
+ *
+ */
+class QueueSampler : public interfaces::Notification {
+   public:
+    /**
+     * @brief Construct a new QueueSampler and start sampling. The sampler does
+     * not take ownership of `file`, which must outlive the sampler. If the
+     * timer cannot be started, the sampler is put in an invalid state.
+     *
+     * @param file The pipe or FIFO to sample
+     * @param period The sampling period
+     * @param threshold The queued byte count at or above which a sample is
+     * reported by `wait`. With a threshold of 0, every sample is reported.
+     */
+    QueueSampler(const File &file, const rix::util::Duration &period, size_t threshold = 0);
+
+    /**
+     * @brief Copy constructor is deleted because the statistics are tracked
+     * per sampler.
+     */
+    QueueSampler(const QueueSampler &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because the statistics are tracked
+     * per sampler.
+     */
+    QueueSampler &operator=(const QueueSampler &other) = delete;
+
+    virtual ~QueueSampler() = default;
+
+    /**
+     * @brief Takes a sample as soon as possible, without changing the sampling
+     * schedule.
+     *
+     */
+    virtual bool raise() const override;
+
+    /**
+     * @brief Wait until a sample at or above the threshold is taken, or until
+     * the specified duration elapses. Samples below the threshold update the
+     * statistics but do not end the wait.
+     *
+     * @param d The maximum duration to wait for a sample to be reported.
+     * @return true if a sample was reported within the duration.
+     */
+    virtual bool wait(const rix::util::Duration &d) const override;
+
+    /**
+     * @brief Returns the last sampled queue size in bytes.
+     *
+     */
+    size_t last() const;
+
+    /**
+     * @brief Returns the largest sampled queue size in bytes since construction
+     * or the last call to `reset`.
+     *
+     */
+    size_t high_water_mark() const;
+
+    /**
+     * @brief Returns the number of samples taken since construction or the
+     * last call to `reset`.
+     *
+     */
+    uint64_t samples() const;
+
+    /**
+     * @brief Returns the alert threshold in bytes.
+     *
+     */
+    size_t threshold() const;
+
+    /**
+     * @brief Clears the high-water mark and the sample count.
+     *
+     */
+    void reset();
+
+    /**
+     * @brief Returns `true` if the sampler is running, `false` otherwise.
+     *
+     */
+    bool ok() const;
+
+    /**
+     * @brief Returns the file descriptor of the sampling timer, or -1 if the
+     * sampler is in an invalid state.
+     *
+     */
+    virtual int fd() const override;
+
+   private:
+    /**
+     * @brief Samples the queue once and updates the statistics.
+     */
+    void sample() const;
+
+    const File &file_;
+    TimerFd timer_;
+    size_t threshold_;
+    mutable size_t last_;
+    mutable size_t high_water_mark_;
+    mutable uint64_t samples_;
+};
+
+}  // namespace ipc
+}  // namespace rix
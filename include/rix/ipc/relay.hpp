@@ -0,0 +1,162 @@
+#pragma once
+
+#include <fcntl.h>
+#include <sys/uio.h>
+
+#include <array>
+#include <cstdint>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/pipe.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class Relay
+ * @brief Moves a byte stream from an input to a live output, and optionally
+ * mirrors it to a recording, without the bytes entering user space. Data is
+ * spliced from the input into an internal pipe, duplicated into a recording
+ * pipe with `tee`, and spliced from the internal pipe to the output. The
+ * recording pipe is drained by `record`, typically on its own thread. When the
+ * recording falls behind and its pipe is full, the recording branch drops data
+ * instead of holding back the live output. Each chunk read by `forward` is
+ * mirrored whole or dropped whole, so the recording only loses data at chunk
+ * boundaries.
+ *
+ */
+class Relay {
+   public:
+    /**
+     * @brief The default maximum number of bytes moved per call.
+     *
+     */
+    static constexpr size_t CHUNK_SIZE = 65536;
+
+    /**
+     * @brief Moves up to `size` bytes from `in` to `out` (`splice`). One of the
+     * two must be a pipe.
+     *
+     * @return ssize_t The number of bytes moved, 0 at end of file, or -1 on
+     * error.
+     */
+    static ssize_t splice(const File &in, const File &out, size_t size, unsigned int flags = SPLICE_F_MOVE);
+
+    /**
+     * @brief Duplicates up to `size` bytes from the pipe `in` into the pipe
+     * `out` without consuming them (`tee`).
+     *
+     * @return ssize_t The number of bytes duplicated, 0 if `in` is empty and
+     * has no writers, or -1 on error.
+     */
+    static ssize_t tee(const File &in, const File &out, size_t size, unsigned int flags = 0);
+
+    /**
+     * @brief Maps the user pages described by `iov` into the pipe `out`
+     * (`vmsplice`). With `SPLICE_F_GIFT` the pages may be moved rather than
+     * copied, in which case the buffers must be page aligned and must not be
+     * modified afterwards.
+     *
+     * @return ssize_t The number of bytes added to the pipe, or -1 on error.
+     */
+    static ssize_t vmsplice(const File &out, const struct iovec *iov, int iovcnt, unsigned int flags = 0);
+
+    /**
+     * @brief Default constructor. The Relay is invalid.
+     *
+     */
+    Relay();
+
+    /**
+     * @brief Construct a Relay from `input` to `output` without a recording.
+     * The Relay does not take ownership of the files, which must outlive it.
+     *
+     */
+    Relay(const File &input, const File &output);
+
+    /**
+     * @brief Construct a Relay from `input` to `output` that mirrors every
+     * byte to `recording`. The Relay does not take ownership of the files,
+     * which must outlive it.
+     *
+     * @param input The file to read from
+     * @param output The live output
+     * @param recording The recording output
+     * @param record_capacity The requested capacity of the recording pipe in
+     * bytes, which bounds how far the recording may fall behind before data is
+     * dropped. The kernel may round it up or refuse it.
+     */
+    Relay(const File &input, const File &output, const File &recording, size_t record_capacity = 1 << 20);
+
+    Relay(const Relay &other) = delete;
+    Relay &operator=(const Relay &other) = delete;
+
+    /**
+     * @brief Moves up to `max` bytes from the input to the output, mirroring
+     * them to the recording pipe if there is room. Blocks until input is
+     * available unless the input is non-blocking, and until the output has
+     * accepted every byte taken from the input.
+     *
+     * @return ssize_t The number of bytes forwarded, 0 at end of input, or -1
+     * on error. At end of input, the recording branch is finished.
+     */
+    ssize_t forward(size_t max = CHUNK_SIZE);
+
+    /**
+     * @brief Moves up to `max` bytes from the recording pipe to the recording.
+     * Blocks until mirrored data is available. May be called from a different
+     * thread than `forward`.
+     *
+     * @return ssize_t The number of bytes recorded, 0 once the recording
+     * branch is finished and drained, or -1 on error.
+     */
+    ssize_t record(size_t max = CHUNK_SIZE) const;
+
+    /**
+     * @brief Stops mirroring. Pending data is still returned by `record`,
+     * which then returns 0.
+     *
+     */
+    void finish();
+
+    /**
+     * @brief Returns the number of bytes forwarded but not mirrored to the
+     * recording because the recording pipe was full. A chunk is dropped whole
+     * when the free space of the recording pipe is smaller than the chunk.
+     * The kernel may still accept only part of a chunk made of many small
+     * buffers, since pipe slots are counted per buffer; the rest of that chunk
+     * is counted here too, and the recording is cut mid-record.
+     *
+     */
+    size_t dropped() const;
+
+    /**
+     * @brief Returns true if the Relay mirrors to a recording.
+     *
+     */
+    bool is_recording() const;
+
+    /**
+     * @brief Returns true if the Relay is valid.
+     *
+     */
+    bool ok() const;
+
+   private:
+    /**
+     * @brief Splices the bytes left in the internal pipe to the output.
+     *
+     */
+    bool flush();
+
+    const File *input_;
+    const File *output_;
+    const File *recording_;
+    std::array<Pipe, 2> live_;
+    std::array<Pipe, 2> mirror_;
+    size_t pending_;
+    size_t dropped_;
+};
+
+}  // namespace ipc
+}  // namespace rix
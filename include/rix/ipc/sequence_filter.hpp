@@ -0,0 +1,114 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "rix/util/time.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class SequenceFilter
+ * @brief Drops stale and reordered messages by their sequence number, such as
+ * `header.seq` of a command received over a `UdpSocket`. A message is accepted
+ * only if its sequence number is newer than that of the last accepted message.
+ * Comparisons wrap around, and a jump back by more than `max_reorder` is taken
+ * as a restarted sender rather than a stale message. A sender that restarts
+ * its count at zero within `max_reorder` is recognized by its stamp instead:
+ * a message that is behind by sequence but stamped after the last accepted
+ * message starts a new session.
+ *
+ */
+class SequenceFilter {
+   public:
+    /**
+     * @brief Constructs a filter that accepts the first message it sees.
+     *
+     * @param max_reorder The largest backward jump that is treated as stale
+     */
+    explicit SequenceFilter(uint32_t max_reorder = 1024)
+        : max_reorder_(max_reorder), last_(0), last_stamp_(), has_last_(false), dropped_(0), restarts_(0) {}
+
+    /**
+     * @brief Returns true and records `seq` if the message should be used, or
+     * false if it is stale or duplicated.
+     *
+     */
+    bool accept(uint32_t seq) {
+        if (has_last_) {
+            uint32_t behind = last_ - seq;
+            if (behind < max_reorder_ || behind == 0) {
+                dropped_++;
+                return false;
+            }
+        }
+        last_ = seq;
+        has_last_ = true;
+        return true;
+    }
+
+    /**
+     * @brief Returns true and records `seq` if the message should be used, or
+     * false if it is stale or duplicated. The stamp is only consulted when
+     * `seq` is behind: a message stamped after the last accepted message comes
+     * from a restarted sender and is accepted, otherwise it is stale. A
+     * message that is ahead by sequence number is accepted whatever its stamp,
+     * so a sender clock that steps back never stops the stream.
+     *
+     */
+    bool accept(uint32_t seq, const rix::util::Time &stamp) {
+        if (has_last_) {
+            uint32_t behind = last_ - seq;
+            if (behind < max_reorder_ || behind == 0) {
+                if (stamp <= last_stamp_) {
+                    dropped_++;
+                    return false;
+                }
+                restarts_++;
+            }
+        }
+        last_ = seq;
+        last_stamp_ = stamp;
+        has_last_ = true;
+        return true;
+    }
+
+    /**
+     * @brief Forgets the last accepted sequence number and stamp.
+     *
+     */
+    void reset() {
+        has_last_ = false;
+        last_stamp_ = rix::util::Time();
+    }
+
+    /**
+     * @brief Returns the sequence number of the last accepted message.
+     *
+     */
+    uint32_t last() const { return last_; }
+
+    /**
+     * @brief Returns the number of messages dropped so far.
+     *
+     */
+    size_t dropped() const { return dropped_; }
+
+    /**
+     * @brief Returns the number of restarted senders detected by stamp.
+     *
+     */
+    size_t restarts() const { return restarts_; }
+
+   private:
+    uint32_t max_reorder_;
+    uint32_t last_;
+    rix::util::Time last_stamp_;
+    bool has_last_;
+    size_t dropped_;
+    size_t restarts_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+#include "rix/ipc/interfaces/io.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class ShmRing
+ * @brief Single-producer/single-consumer byte stream over a ring buffer in
+ * POSIX shared memory (`/dev/shm`). Reads and writes are plain memory copies;
+ * a futex wakeup is only issued when the peer is parked waiting for data or
+ * space. The stream behaves like a pipe: blocking writes transfer every byte,
+ * reads return whatever is available, and a read returns 0 once the writer
+ * has closed and the ring is drained.
+ *
+ * A ShmRing is not backed by a file descriptor, so it cannot be registered
+ * with a `Poller`.
+ *
+ */
+class ShmRing : public interfaces::IO {
+   public:
+    enum class Mode : int { WRITE, READ };
+
+    /**
+     * @brief Removes the shared memory object specified by `name`.
+     *
+     * @param name The name of the ring
+     * @return true if the object was successfully removed.
+     */
+    static bool remove(const std::string &name);
+
+    /**
+     * @brief Default constructor. Does not map a ring.
+     *
+     */
+    ShmRing();
+
+    /**
+     * @brief Opens the ring specified by `name`, creating it if it does not
+     * exist. The side that creates the ring chooses its capacity; the other
+     * side waits (up to one second) for the creator to initialize it.
+     *
+     * @param name The name of the ring (a leading '/' is added if missing)
+     * @param mode The mode to open the ring with (READ or WRITE)
+     * @param capacity The capacity of the ring in bytes, if it is created
+     * @param nonblocking Flag to toggle non-blocking IO
+     */
+    ShmRing(const std::string &name, Mode mode, size_t capacity = 65536, bool nonblocking = false);
+
+    /**
+     * @brief Copy constructor is deleted because each end of the ring must
+     * have a single owner.
+     */
+    ShmRing(const ShmRing &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because each end of the ring must
+     * have a single owner.
+     */
+    ShmRing &operator=(const ShmRing &other) = delete;
+
+    /**
+     * @brief Move constructor. Moves the mapping to the destination and
+     * invalidates the source.
+     */
+    ShmRing(ShmRing &&other);
+
+    /**
+     * @brief Move assignment operator. Closes the destination if valid, then
+     * moves the mapping from the source and invalidates the source.
+     */
+    ShmRing &operator=(ShmRing &&other);
+
+    /**
+     * @brief Destructor. Marks this end as closed, wakes the peer and unmaps
+     * the ring. The shared memory object itself is not removed.
+     *
+     */
+    virtual ~ShmRing();
+
+    /**
+     * @brief Read up to `size` bytes from the ring.
+     *
+     * @return ssize_t The number of bytes read, 0 if the writer has closed and
+     * the ring is empty, or -1 on error (`EAGAIN` in non-blocking mode).
+     */
+    virtual ssize_t read(uint8_t *dst, size_t size) const override;
+
+    /**
+     * @brief Write `size` bytes to the ring. In blocking mode, waits for space
+     * until every byte is written. In non-blocking mode, writes as many bytes
+     * as fit.
+     *
+     * @return ssize_t The number of bytes written, or -1 on error (`EPIPE` if
+     * the reader has closed, `EAGAIN` if the ring is full in non-blocking
+     * mode).
+     */
+    virtual ssize_t write(const uint8_t *src, size_t size) const override;
+
+    /**
+     * @brief Scatter read. Fills the buffers described by `iov` in order with
+     * the available data.
+     */
+    virtual ssize_t readv(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Gather write. Writes the buffers described by `iov` in order.
+     */
+    virtual ssize_t writev(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Waits for the specified duration for data to become available or
+     * for the writer to close.
+     */
+    virtual bool wait_for_readable(const util::Duration &duration) const override;
+
+    /**
+     * @brief Waits for the specified duration for space to become available or
+     * for the reader to close.
+     */
+    virtual bool wait_for_writable(const util::Duration &duration) const override;
+
+    virtual void set_nonblocking(bool status) override;
+    virtual bool is_nonblocking() const override;
+
+    /**
+     * @brief Returns `true` if the ring is mapped, `false` otherwise.
+     */
+    bool ok() const;
+
+    /**
+     * @brief Returns the name of the ring.
+     *
+     */
+    std::string name() const;
+
+    /**
+     * @brief Returns the mode of the ring.
+     *
+     */
+    Mode mode() const;
+
+    /**
+     * @brief Returns the capacity of the ring in bytes.
+     *
+     */
+    size_t capacity() const;
+
+   private:
+    /**
+     * @brief Control block at the start of the shared memory object. Positions
+     * are free-running byte counts; the producer and consumer fields live on
+     * separate cache lines.
+     */
+    struct Header {
+        std::atomic<uint32_t> magic;
+        uint32_t capacity;
+
+        alignas(64) std::atomic<uint64_t> head;   /**< Total bytes written */
+        std::atomic<uint32_t> writer_closed;
+        std::atomic<uint32_t> writer_parked;     /**< Writers waiting for space */
+        std::atomic<uint32_t> space_seq;         /**< Futex word for space */
+
+        alignas(64) std::atomic<uint64_t> tail;   /**< Total bytes read */
+        std::atomic<uint32_t> reader_closed;
+        std::atomic<uint32_t> reader_parked;     /**< Readers waiting for data */
+        std::atomic<uint32_t> data_seq;          /**< Futex word for data */
+    };
+
+    void close();
+    size_t map_size() const;
+
+    Header *header_;
+    uint8_t *data_;
+    std::string name_;
+    Mode mode_;
+    bool nonblocking_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -4,27 +4,53 @@
 #include <signal.h>
 #include <unistd.h>
 
+#include <atomic>
 #include <functional>
+#include <memory>
 
 #include "rix/ipc/interfaces/notification.hpp"
 #include "rix/ipc/pipe.hpp"
+#include "rix/ipc/wait_strategy.hpp"
 
 namespace rix {
 namespace ipc {
 
 /**
  * @class Signal
- * @brief Asynchronous event handler for POSIX reliable signals.
+ * @brief Asynchronous event handler for POSIX reliable signals and realtime
+ * signals (`SIGRTMIN` to `SIGRTMAX`). Every delivery is recorded with its
+ * `siginfo`, so realtime signals sent with `sigqueue` can carry a payload.
  *
  */
 class Signal : public interfaces::Notification {
    public:
+    /**
+     * @brief Information recorded by the handler for a single delivery.
+     *
+     */
+    struct Info {
+        int signum;          /**< The signal number */
+        union sigval value;  /**< The payload sent with `sigqueue` */
+        int code;            /**< The origin of the signal (e.g. `SI_USER`, `SI_QUEUE`) */
+        pid_t pid;           /**< The ID of the sending process */
+        uid_t uid;           /**< The real user ID of the sending process */
+    };
+
+    /**
+     * @brief Maximum number of deliveries recorded and not yet consumed. Further
+     * deliveries are dropped and counted by `dropped`.
+     *
+     */
+    static constexpr size_t QUEUE_CAPACITY = 256;
+
     /**
      * @brief Construct a new Signal object. This function will throw a
-     * `std::invalid_argument` error if `signum` is less than 1 or greater than
-     * 32 or if another Signal object with the same value already exists.
+     * `std::invalid_argument` error if `signum` is not between 1 and 32 or
+     * between `SIGRTMIN` and `SIGRTMAX`, or if another Signal object with the
+     * same value already exists.
      *
-     * @param signum The signal number (must be between 1 and 32)
+     * @param signum The signal number (between 1 and 32, or between
+     * `SIGRTMIN` and `SIGRTMAX`)
      */
     Signal(int signum);
 
@@ -82,6 +108,26 @@ class Signal : public interfaces::Notification {
      */
     bool kill(pid_t pid) const;
 
+    /**
+     * @brief Send the signal with a payload to the process specified by `pid`.
+     * Realtime signals are queued by the kernel, so every payload is
+     * delivered. If the Signal is in an invalid state, returns `false`
+     * immediately. Returns `true` if sigqueue system call was successful.
+     *
+     * @param pid The ID of the receiving process
+     * @param value The payload
+     */
+    bool queue(pid_t pid, union sigval value) const;
+
+    /**
+     * @brief Send the signal with an integer payload to the process specified
+     * by `pid`.
+     *
+     * @param pid The ID of the receiving process
+     * @param value The payload
+     */
+    bool queue(pid_t pid, int value) const;
+
     /**
      * @brief Returns the numerical value of the Signal, or -1 if the Signal is
      * in an invalid state.
@@ -97,45 +143,165 @@ class Signal : public interfaces::Notification {
      *
      * @param d The maximum duration to wait for the signal to arrive.
      *
+     * Each successful wait consumes exactly one delivery, in the order the
+     * deliveries were received, and makes its information available from
+     * `info`.
      */
     virtual bool wait(const rix::util::Duration &d) const;
 
+    /**
+     * @brief Sets how `wait` waits. While spinning, only the pending counter
+     * set by the handler is checked, so no system call is made until a signal
+     * has arrived.
+     *
+     */
+    void set_wait_strategy(const WaitStrategy &strategy);
+
+    /**
+     * @brief Returns the wait strategy.
+     *
+     */
+    const WaitStrategy &wait_strategy() const;
+
+    /**
+     * @brief Returns how the waits on this Signal have ended so far.
+     *
+     */
+    const WaitStats &wait_stats() const;
+
+    /**
+     * @brief Clears the wait statistics.
+     *
+     */
+    void reset_wait_stats();
+
+    /**
+     * @brief Returns `true` and consumes the signal if it has been received,
+     * without blocking. The pending counter set by the handler is checked
+     * first, so no system call is made unless a signal is pending.
+     *
+     */
+    virtual bool is_ready() const override;
+
+    /**
+     * @brief Returns the information of the last delivery consumed by `wait`
+     * or `is_ready`. `signum` is 0 if no delivery has been consumed.
+     *
+     */
+    const Info &info() const;
+
+    /**
+     * @brief Returns the number of deliveries dropped because the queue was
+     * full, or 0 if the Signal is in an invalid state.
+     *
+     */
+    size_t dropped() const;
+
+    /**
+     * @brief Returns the read end of the notifier pipe for this signal, which
+     * becomes readable when the signal is received, or -1 if the Signal is in
+     * an invalid state.
+     *
+     */
+    virtual int fd() const override;
+
    private:
     /**
-     * @brief SignalNotifier struct contains a pipe and an initialization flag.
-     * The pipe should be written to from within a signal handler function.
+     * @brief Bounded lock-free queue of delivery information. Pushing is
+     * async-signal-safe and may happen concurrently from handlers running on
+     * several threads; popping is done by the owner of the Signal. Each cell
+     * carries a sequence number that tells producers and the consumer whether
+     * it is free or filled (D. Vyukov's bounded MPMC queue). The cells live in
+     * the static notifier for the life of the process, so a handler never
+     * touches freed memory.
+     *
+     */
+    class InfoQueue {
+       public:
+        InfoQueue();
+
+        /**
+         * @brief Empties the queue. Must not run while a handler may push.
+         */
+        void clear();
+        bool push(const Info &info);
+        bool pop(Info &info);
+
+       private:
+        static_assert((QUEUE_CAPACITY & (QUEUE_CAPACITY - 1)) == 0, "Queue capacity must be a power of two");
+        static constexpr size_t MASK = QUEUE_CAPACITY - 1;
+
+        struct Cell {
+            std::atomic<size_t> sequence;
+            Info info;
+        };
+
+        std::array<Cell, QUEUE_CAPACITY> cells_;
+        alignas(64) std::atomic<size_t> head_; /**< Next cell to push */
+        alignas(64) std::atomic<size_t> tail_; /**< Next cell to pop */
+    };
+
+    /**
+     * @brief SignalNotifier struct contains a pipe, a delivery queue, a pending
+     * counter and an initialization flag. The handler pushes to the queue,
+     * increments the counter and writes a byte to the pipe for every delivery.
      *
      */
     struct SignalNotifier {
-        SignalNotifier() : is_init(false) {};
-        std::array<Pipe, 2> pipe; /**< 0: read end, 1: write end */
-        bool is_init;             /**< false if SignalNotifier has not been initialized */
+        SignalNotifier() : pending(0), dropped(0), is_init(false) {};
+        std::array<Pipe, 2> pipe;         /**< 0: read end, 1: write end */
+        InfoQueue queue;                  /**< Deliveries not yet consumed */
+        std::atomic<uint32_t> pending;    /**< Number of signals written to the pipe and not yet consumed */
+        std::atomic<size_t> dropped;      /**< Number of deliveries dropped because the queue was full */
+        std::atomic<bool> is_init;        /**< false if SignalNotifier has not been initialized */
     };
 
+    static_assert(std::atomic<uint32_t>::is_always_lock_free,
+                  "The pending counter must be lock-free to be used in a signal handler");
+
     /**
      * @brief Static array of SignalNotifier structs. Elements of this array
      * will only be initialized once a Signal object is created with a signal
      * number that corresponds to an element in this array.
      *
      */
-    static std::array<SignalNotifier, 32> notifier;
+    static std::array<SignalNotifier, 64> notifier;
+
+    /**
+     * @brief Returns `true` if `signum` is a reliable or realtime signal
+     * number.
+     *
+     */
+    static bool is_valid(int signum);
+
+    /**
+     * @brief Releases the notifier of this Signal and resets the signal to
+     * default behavior.
+     *
+     */
+    void reset();
 
     /**
-     * @brief The signal handler. This must be a static function because the
-     * Standard C Library signal API requires the function to return void and
-     * have a single integer argument. If this were a member function, it would
-     * have an implicit Signal* argument. This implies that any data accessed
-     * or modified by the handler must also be global or static.
+     * @brief The signal handler, installed with `SA_SIGINFO`. This must be a
+     * static function because the `sigaction` API requires a plain function
+     * pointer. If this were a member function, it would have an implicit
+     * Signal* argument. This implies that any data accessed or modified by the
+     * handler must also be global or static.
      *
      * @warning This function must only invoke async-signal-safe functions. For
      * information on signal safety, consult:
      * https://www.man7.org/linux/man-pages/man7/signal-safety.7.html.
      *
      * @param signum The number of the received signal.
+     * @param info The information of the delivery.
+     * @param context The interrupted context (unused).
      */
-    static void handler(int signum);
+    static void handler(int signum, siginfo_t *info, void *context);
 
     int signum_;
+    mutable Info info_;
+    WaitStrategy wait_strategy_;
+    mutable WaitStats wait_stats_;
 };
 
 }  // namespace ipc
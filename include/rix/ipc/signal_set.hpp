@@ -0,0 +1,143 @@
+#pragma once
+
+#include <signal.h>
+#include <sys/signalfd.h>
+
+#include <initializer_list>
+#include <vector>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class SignalSet
+ * @brief Notification for a set of POSIX signals delivered through a single
+ * signalfd. The signals are blocked in the constructing thread so that they
+ * are queued for the signalfd instead of interrupting the process, and no
+ * signal handler, pipe or write syscall is involved. The set is pollable, so
+ * it can be registered with a `Poller`.
+ *
+ * @warning Signals are blocked per thread. Construct the SignalSet before
+ * spawning threads (which inherit the mask), or the signals may be delivered
+ * with their default action to a thread that does not block them.
+ *
+ */
+class SignalSet : public interfaces::Notification {
+   public:
+    /**
+     * @brief Construct a new SignalSet object. This function will throw a
+     * `std::invalid_argument` error if the set is empty, if any signal number
+     * is invalid or cannot be blocked (SIGKILL, SIGSTOP). It throws a
+     * `std::system_error` if the signals cannot be blocked or the signalfd
+     * cannot be created.
+     *
+     * @param signums The signal numbers in the set
+     */
+    SignalSet(std::initializer_list<int> signums);
+
+    /**
+     * @brief Destroy the SignalSet object. Discards pending signals of the
+     * set, closes the signalfd and unblocks the signals that were not blocked
+     * before construction.
+     *
+     */
+    virtual ~SignalSet();
+
+    /**
+     * @brief Copy constructor is deleted because the signal mask can only be
+     * restored once.
+     */
+    SignalSet(const SignalSet &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because the signal mask can only
+     * be restored once.
+     */
+    SignalSet &operator=(const SignalSet &other) = delete;
+
+    /**
+     * @brief Move constructor. The moved SignalSet is put in an invalid state.
+     *
+     */
+    SignalSet(SignalSet &&other);
+
+    /**
+     * @brief Move assignment operator. If the destination SignalSet is valid,
+     * it is destroyed before the source is moved into it.
+     *
+     */
+    SignalSet &operator=(SignalSet &&other);
+
+    /**
+     * @brief Raise the first signal of the set in the current thread. Returns
+     * `false` if the SignalSet is in an invalid state.
+     *
+     */
+    virtual bool raise() const override;
+
+    /**
+     * @brief Raise `signum` in the current thread. Returns `false` if the
+     * SignalSet is in an invalid state or `signum` is not in the set.
+     *
+     */
+    bool raise(int signum) const;
+
+    /**
+     * @brief Send `signum` to the process specified by `pid`. Returns `false`
+     * if the SignalSet is in an invalid state or `signum` is not in the set.
+     *
+     */
+    bool kill(pid_t pid, int signum) const;
+
+    /**
+     * @brief Returns `true` if `signum` is in the set.
+     *
+     */
+    bool contains(int signum) const;
+
+    /**
+     * @brief Returns the signal numbers in the set, or an empty vector if the
+     * SignalSet is in an invalid state.
+     *
+     */
+    std::vector<int> signums() const;
+
+    /**
+     * @brief Wait until any signal of the set is received, or until the
+     * specified duration elapses. A received signal is consumed and its
+     * information is available from `info`.
+     *
+     * @param d The maximum duration to wait for a signal to arrive.
+     * @return true if a signal was received within the duration.
+     */
+    virtual bool wait(const rix::util::Duration &d) const override;
+
+    /**
+     * @brief Returns the information of the last signal consumed by `wait`.
+     * `ssi_signo` is 0 if no signal has been consumed.
+     *
+     */
+    const struct signalfd_siginfo &info() const;
+
+    /**
+     * @brief Returns the signalfd, or -1 if the SignalSet is in an invalid
+     * state.
+     *
+     */
+    virtual int fd() const override;
+
+   private:
+    void reset();
+
+    File file_;
+    sigset_t mask_;     /**< The signals in the set */
+    sigset_t blocked_;  /**< The signals of the set blocked by this object */
+    std::vector<int> signums_;
+    mutable struct signalfd_siginfo info_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,169 @@
+#pragma once
+
+#include <sys/timerfd.h>
+
+#include <cstdint>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/interfaces/notification.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class TimerFd
+ * @brief Notification backed by a timerfd on `CLOCK_MONOTONIC`. The timer can
+ * be one-shot or periodic, relative or armed at an absolute deadline, and is
+ * pollable, so a thread can wait on "timer fired or input arrived" with a
+ * single `Poller` instead of sleeping.
+ *
+ */
+class TimerFd : public interfaces::Notification {
+   public:
+    /**
+     * @brief Returns the current time of `CLOCK_MONOTONIC` as a duration since
+     * an unspecified starting point. Absolute deadlines passed to `start_at`
+     * are expressed on this clock.
+     *
+     */
+    static rix::util::Duration now();
+
+    /**
+     * @brief Creates a new, disarmed timerfd. If the timerfd cannot be created,
+     * the TimerFd is put in an invalid state (`ok` returns false).
+     *
+     */
+    TimerFd();
+
+    /**
+     * @brief Copy constructor is deleted because the expiration counts are
+     * tracked per object.
+     */
+    TimerFd(const TimerFd &other) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because the expiration counts are
+     * tracked per object.
+     */
+    TimerFd &operator=(const TimerFd &other) = delete;
+
+    /**
+     * @brief Move constructor. The moved TimerFd is put in an invalid state.
+     *
+     */
+    TimerFd(TimerFd &&other) = default;
+
+    /**
+     * @brief Move assignment operator. The moved TimerFd is put in an invalid
+     * state.
+     *
+     */
+    TimerFd &operator=(TimerFd &&other) = default;
+
+    virtual ~TimerFd() = default;
+
+    /**
+     * @brief Arms the timer to first expire after `delay`, then every `period`.
+     * Resets the overrun count.
+     *
+     * @param delay The delay until the first expiration (must be positive)
+     * @param period The period of subsequent expirations, or 0 for a one-shot
+     * timer
+     * @return true if the timer was armed.
+     */
+    bool start(const rix::util::Duration &delay, const rix::util::Duration &period = rix::util::Duration(0.0));
+
+    /**
+     * @brief Arms the timer to first expire at the absolute `deadline` on
+     * `CLOCK_MONOTONIC` (see `now`), then every `period`. A deadline in the
+     * past expires immediately. Resets the overrun count.
+     *
+     * @param deadline The time of the first expiration
+     * @param period The period of subsequent expirations, or 0 for a one-shot
+     * timer
+     * @return true if the timer was armed.
+     */
+    bool start_at(const rix::util::Duration &deadline, const rix::util::Duration &period = rix::util::Duration(0.0));
+
+    /**
+     * @brief Disarms the timer. Expirations that have not been consumed are
+     * discarded.
+     *
+     */
+    bool stop();
+
+    /**
+     * @brief Returns `true` if the timer is armed.
+     *
+     */
+    bool is_armed() const;
+
+    /**
+     * @brief Returns the time until the next expiration, or 0 if the timer is
+     * disarmed.
+     *
+     */
+    rix::util::Duration remaining() const;
+
+    /**
+     * @brief Returns the period of the timer, or 0 if it is one-shot or
+     * disarmed.
+     *
+     */
+    rix::util::Duration period() const;
+
+    /**
+     * @brief Makes the timer ready immediately. The schedule is kept only if
+     * the kernel supports setting the expiration count (`TFD_IOC_SET_TICKS`).
+     * Otherwise raise disarms the timer and re-arms it to expire now and then
+     * every `period`: the phase of a periodic timer shifts to the time of the
+     * call, and the pending expiration of a one-shot timer is replaced.
+     *
+     */
+    virtual bool raise() const override;
+
+    /**
+     * @brief Wait until the timer expires, or until the specified duration
+     * elapses, and consume all of its pending expirations.
+     *
+     * @param d The maximum duration to wait for the timer to expire.
+     * @return true if the timer expired within the duration.
+     */
+    virtual bool wait(const rix::util::Duration &d) const override;
+
+    /**
+     * @brief Returns the number of expirations consumed by the last successful
+     * wait. A value greater than 1 means that periods were missed.
+     *
+     */
+    uint64_t expirations() const;
+
+    /**
+     * @brief Returns the total number of missed periods (expirations beyond the
+     * first consumed by each wait) since the timer was last started.
+     *
+     */
+    uint64_t overruns() const;
+
+    /**
+     * @brief Returns `true` if the timerfd is valid, `false` otherwise.
+     *
+     */
+    bool ok() const;
+
+    /**
+     * @brief Returns the timerfd, or -1 if the TimerFd is in an invalid state.
+     *
+     */
+    virtual int fd() const override;
+
+   private:
+    bool arm(const rix::util::Duration &value, const rix::util::Duration &period, int flags);
+
+    File file_;
+    mutable uint64_t expirations_;
+    mutable uint64_t overruns_;
+};
+
+}  // namespace ipc
+}  // namespace rix
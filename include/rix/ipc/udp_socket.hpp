@@ -0,0 +1,130 @@
+#pragma once
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "rix/ipc/file.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class UdpSocket
+ * @brief IPv4 datagram socket. Inherits from the `File` class. Once connected
+ * to a peer or a multicast group, each write or gather write sends one
+ * datagram and each read returns at most one datagram, so a length-prefixed
+ * frame written with a single `writev` arrives whole or not at all. Datagrams
+ * may be lost or reordered; see `SequenceFilter`.
+ *
+ */
+class UdpSocket : public File {
+   public:
+    /**
+     * @brief Default constructor. Does not open a socket.
+     *
+     */
+    UdpSocket();
+
+    /**
+     * @brief Opens a socket bound to `address` and `port`. If opening or
+     * binding fails, the UdpSocket is put in an invalid state.
+     *
+     * @param address The local IPv4 address to bind to. Use "0.0.0.0" to
+     * receive on every interface, which is required to receive multicast.
+     * @param port The local port. Use 0 to let the kernel pick one.
+     * @param nonblocking Flag to toggle non-blocking IO
+     */
+    UdpSocket(const std::string &address, uint16_t port, bool nonblocking = false);
+
+    UdpSocket(const UdpSocket &src) = default;
+    UdpSocket &operator=(const UdpSocket &src) = default;
+    UdpSocket(UdpSocket &&src) = default;
+    UdpSocket &operator=(UdpSocket &&src) = default;
+    virtual ~UdpSocket() = default;
+
+    /**
+     * @brief Sets the default destination for writes and restricts reads to
+     * datagrams from that peer. The peer may be a multicast group.
+     *
+     * @param address The IPv4 address of the peer
+     * @param port The port of the peer
+     * @return true if successful, false otherwise
+     */
+    bool connect(const std::string &address, uint16_t port);
+
+    /**
+     * @brief Joins the multicast `group` on the interface with the given
+     * address. The socket must be bound to the group's port.
+     *
+     * @param group The IPv4 multicast address
+     * @param interface The IPv4 address of the local interface
+     * @return true if successful, false otherwise
+     */
+    bool join_group(const std::string &group, const std::string &interface = "0.0.0.0");
+
+    /**
+     * @brief Selects the interface that outgoing multicast datagrams are sent
+     * from, and whether they are looped back to receivers on this host.
+     *
+     * @param interface The IPv4 address of the local interface
+     * @param loopback Flag to deliver sent datagrams to local group members
+     * @return true if successful, false otherwise
+     */
+    bool set_multicast_interface(const std::string &interface, bool loopback = true);
+
+    /**
+     * @brief Lets a blocking read busy poll the device queue for up to `usec`
+     * microseconds before sleeping (`SO_BUSY_POLL`). Raising the value above
+     * the `net.core.busy_read` sysctl requires `CAP_NET_ADMIN`, and drivers
+     * without busy poll support ignore it.
+     *
+     * @return true if successful, false otherwise
+     */
+    bool set_busy_poll(int usec);
+
+    /**
+     * @brief Marks outgoing datagrams as latency sensitive, giving them the
+     * interactive socket priority and the low delay type of service.
+     *
+     * @return true if successful, false otherwise
+     */
+    bool set_low_latency();
+
+    /**
+     * @brief Returns the local port the socket is bound to, or 0 on error.
+     *
+     */
+    uint16_t port() const;
+
+    /**
+     * @brief Sends each element of `messages` as one datagram to the connected
+     * peer with a single `sendmmsg` call.
+     *
+     * @return int The number of datagrams sent, which may be fewer than
+     * requested if the send buffer fills, or -1 on error.
+     */
+    int send_batch(const std::vector<std::vector<uint8_t>> &messages) const;
+
+    /**
+     * @brief Receives up to `max_messages` queued datagrams with a single
+     * `recvmmsg` call. Blocks for the first datagram unless the socket is
+     * non-blocking; further datagrams are only taken if already queued.
+     *
+     * @param messages The destination for the datagrams. Each element is
+     * resized to the length of its datagram, and the vector is resized to the
+     * number of datagrams received. Elements are reused across calls.
+     * @param max_messages The maximum number of datagrams to receive
+     * @param max_size The maximum size of a datagram in bytes. Longer
+     * datagrams are truncated.
+     * @return int The number of datagrams received, or -1 on error.
+     */
+    int recv_batch(std::vector<std::vector<uint8_t>> &messages, size_t max_messages = 16,
+                   size_t max_size = 1472) const;
+};
+
+}  // namespace ipc
+}  // namespace rix
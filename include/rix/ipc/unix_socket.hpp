@@ -0,0 +1,183 @@
+#pragma once
+
+#include <sys/socket.h>
+#include <sys/un.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "rix/ipc/file.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class UnixSocket
+ * @brief Connected endpoint of a local `SOCK_SEQPACKET` socket. Inherits from
+ * the `File` class. Like a packet-mode pipe, each write is one message and
+ * each read returns at most one whole message, but the connection is
+ * bidirectional, a listener can serve many clients, and a read returns 0 as
+ * soon as the peer closes or dies. Writes never raise `SIGPIPE`; they fail
+ * with `EPIPE` instead.
+ *
+ */
+class UnixSocket : public File {
+   public:
+    /**
+     * @brief Factory method to create a pair of connected UnixSocket objects
+     * with `socketpair`.
+     *
+     * @return std::array<UnixSocket, 2> The connected pair
+     */
+    static std::array<UnixSocket, 2> pair();
+
+    /**
+     * @brief Default constructor. Does not open a socket.
+     *
+     */
+    UnixSocket();
+
+    /**
+     * @brief Connects to the `UnixListener` bound to `pathname`. If the
+     * connection fails, the UnixSocket is put in an invalid state.
+     *
+     * @param pathname The path of the listening socket
+     * @param nonblocking Flag to toggle non-blocking IO
+     */
+    UnixSocket(const std::string &pathname, bool nonblocking = false);
+
+    /**
+     * @brief Wraps an already connected socket file descriptor. This will not
+     * duplicate the file descriptor.
+     *
+     * @param fd The file descriptor
+     */
+    explicit UnixSocket(int fd);
+
+    UnixSocket(const UnixSocket &src) = default;
+    UnixSocket &operator=(const UnixSocket &src) = default;
+    UnixSocket(UnixSocket &&src) = default;
+    UnixSocket &operator=(UnixSocket &&src) = default;
+    virtual ~UnixSocket() = default;
+
+    /**
+     * @brief Sends `size` bytes as one message.
+     *
+     * @return ssize_t The number of bytes sent, or -1 on error (`EPIPE` if the
+     * peer has closed).
+     */
+    virtual ssize_t write(const uint8_t *src, size_t size) const override;
+
+    /**
+     * @brief Sends the buffers described by `iov` as one message.
+     *
+     * @return ssize_t The number of bytes sent, or -1 on error (`EPIPE` if the
+     * peer has closed).
+     */
+    virtual ssize_t writev(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Receives up to `max_messages` queued messages with a single
+     * `recvmmsg` call. Blocks for the first message unless the socket is
+     * non-blocking; further messages are only taken if already queued.
+     *
+     * @param messages The destination for the messages. Each element is
+     * resized to the length of its message, and the vector is resized to the
+     * number of messages received. Elements are reused across calls.
+     * @param max_messages The maximum number of messages to receive
+     * @param max_size The maximum size of a message in bytes. Longer messages
+     * are truncated.
+     * @return int The number of messages received, 0 if the peer has closed,
+     * or -1 on error. Empty messages cannot be told apart from end of file at
+     * the end of a batch, so they should not be sent.
+     */
+    int recv_batch(std::vector<std::vector<uint8_t>> &messages, size_t max_messages = 16,
+                   size_t max_size = 4096) const;
+
+    /**
+     * @brief Returns the process ID of the peer (`SO_PEERCRED`), or -1 on
+     * error.
+     *
+     */
+    pid_t peer_pid() const;
+};
+
+/**
+ * @class UnixListener
+ * @brief Listening `SOCK_SEQPACKET` socket bound to a path in the file system.
+ * Inherits from the `File` class, so it can be registered with a `Poller`; it
+ * becomes readable when a client is waiting to be accepted.
+ *
+ */
+class UnixListener : public File {
+   public:
+    /**
+     * @brief Default constructor. Does not open a socket.
+     *
+     */
+    UnixListener();
+
+    /**
+     * @brief Binds to `pathname`, replacing any stale socket file, and starts
+     * listening. If binding fails, the UnixListener is put in an invalid state.
+     *
+     * @param pathname The path to bind to
+     * @param backlog The maximum number of pending connections
+     * @param nonblocking Flag to toggle non-blocking accepts
+     */
+    UnixListener(const std::string &pathname, int backlog = 16, bool nonblocking = false);
+
+    /**
+     * @brief Copy constructor is deleted because the listener removes its
+     * socket file on destruction.
+     */
+    UnixListener(const UnixListener &src) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because the listener removes its
+     * socket file on destruction.
+     */
+    UnixListener &operator=(const UnixListener &src) = delete;
+
+    /**
+     * @brief Move constructor. Moves the socket to the destination and
+     * invalidates the source.
+     */
+    UnixListener(UnixListener &&src);
+
+    /**
+     * @brief Move assignment operator. Closes the destination if valid, then
+     * moves the socket from the source and invalidates the source.
+     */
+    UnixListener &operator=(UnixListener &&src);
+
+    /**
+     * @brief Destructor. Closes the socket and removes the socket file.
+     *
+     */
+    virtual ~UnixListener();
+
+    /**
+     * @brief Accepts a pending connection. Blocks until a client connects
+     * unless the listener is non-blocking.
+     *
+     * @param nonblocking Flag to toggle non-blocking IO on the accepted socket
+     * @return UnixSocket The connected socket, which is invalid on error.
+     */
+    UnixSocket accept(bool nonblocking = false) const;
+
+    /**
+     * @brief Returns the path the listener is bound to.
+     *
+     */
+    std::string pathname() const;
+
+   private:
+    void close();
+
+    std::string pathname_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "rix/ipc/file.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @class UringFile
+ * @brief File whose reads and writes are submitted through an io_uring
+ * submission ring. Single `read`/`write` calls follow the `interfaces::IO`
+ * contract and complete before returning. In addition, reads and writes can be
+ * queued with `queue_read`/`queue_write` and submitted together with `flush`,
+ * which enters the kernel once for the whole batch and reaps the completions
+ * in bulk. Queued operations are linked so they execute in queue order, and
+ * a short or failed operation ends the batch.
+ *
+ * If the kernel does not support io_uring (or it is disabled by a queue depth
+ * of 0), every operation falls back to plain system calls, and `flush`
+ * gathers consecutive queued operations of the same kind into one
+ * `readv`/`writev`.
+ *
+ */
+class UringFile : public File {
+   public:
+    /**
+     * @brief Default constructor. Does not open a file or a ring.
+     *
+     */
+    UringFile();
+
+    /**
+     * @brief Creates a UringFile object with the corresponding file
+     * descriptor. This will not duplicate the file descriptor.
+     *
+     * @param fd The file descriptor
+     * @param queue_depth The number of submission queue entries (0 disables
+     * io_uring).
+     */
+    UringFile(int fd, unsigned queue_depth = 64);
+
+    /**
+     * @brief Creates a UringFile object by opening the file specified by the
+     * path name. See `File::File` for the description of `creation_flags` and
+     * `mode`.
+     *
+     * @param pathname The path name of the file to be opened.
+     * @param creation_flags The creation flags.
+     * @param mode The file mode bits.
+     * @param queue_depth The number of submission queue entries (0 disables
+     * io_uring).
+     */
+    UringFile(std::string pathname, int creation_flags, mode_t mode = 0, unsigned queue_depth = 64);
+
+    /**
+     * @brief Copy constructor is deleted because a submission ring cannot be
+     * shared.
+     */
+    UringFile(const UringFile &src) = delete;
+
+    /**
+     * @brief Assignment operator is deleted because a submission ring cannot
+     * be shared.
+     */
+    UringFile &operator=(const UringFile &src) = delete;
+
+    /**
+     * @brief Move constructor. Moves the file descriptor and the ring to the
+     * destination and invalidates the source.
+     */
+    UringFile(UringFile &&src);
+
+    /**
+     * @brief Move assignment operator. Flushes and closes the destination if
+     * valid, then moves the file descriptor and the ring from the source.
+     */
+    UringFile &operator=(UringFile &&src);
+
+    /**
+     * @brief Destructor. Flushes queued operations, then closes the ring and
+     * the file descriptor.
+     *
+     */
+    virtual ~UringFile();
+
+    /**
+     * @brief Read `size` bytes from the file through the ring. Queued
+     * operations are flushed first to preserve ordering.
+     *
+     * @return ssize_t The number of bytes actually read, or -1 on error.
+     */
+    virtual ssize_t read(uint8_t *dst, size_t size) const override;
+
+    /**
+     * @brief Write `size` bytes to the file through the ring. Queued
+     * operations are flushed first to preserve ordering.
+     *
+     * @return ssize_t The number of bytes actually written, or -1 on error.
+     */
+    virtual ssize_t write(const uint8_t *src, size_t size) const override;
+
+    /**
+     * @brief Scatter read through the ring.
+     *
+     * @return ssize_t The number of bytes actually read, or -1 on error.
+     */
+    virtual ssize_t readv(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Gather write through the ring.
+     *
+     * @return ssize_t The number of bytes actually written, or -1 on error.
+     */
+    virtual ssize_t writev(const struct iovec *iov, int iovcnt) const override;
+
+    /**
+     * @brief Queues a read of `size` bytes into `dst`. The buffer must remain
+     * valid until the next `flush`. If the submission queue is full, the
+     * queued operations are flushed first.
+     *
+     * @return true if the operation was queued.
+     */
+    bool queue_read(uint8_t *dst, size_t size);
+
+    /**
+     * @brief Queues a write of `size` bytes from `src`. The buffer must remain
+     * valid until the next `flush`. If the submission queue is full, the
+     * queued operations are flushed first.
+     *
+     * @return true if the operation was queued.
+     */
+    bool queue_write(const uint8_t *src, size_t size);
+
+    /**
+     * @brief Submits every queued operation with a single kernel entry and
+     * waits for all of them to complete. Like `readv`/`writev`, the batch ends
+     * at the first short or failed operation, and the operations after it are
+     * not performed.
+     *
+     * @return ssize_t The total number of bytes transferred, or -1 if the
+     * batch failed before transferring any bytes (`errno` is set from the
+     * failure).
+     */
+    ssize_t flush() const;
+
+    /**
+     * @brief Returns the number of operations queued since the last flush.
+     *
+     */
+    size_t queued() const;
+
+    /**
+     * @brief Returns `true` if operations are submitted through io_uring,
+     * `false` if this object fell back to plain system calls.
+     *
+     */
+    bool is_uring() const;
+
+   private:
+    struct Ring;
+
+    /**
+     * @brief A queued operation, kept for the system call fallback.
+     */
+    struct Op {
+        bool write;
+        struct iovec iov;
+    };
+
+    /**
+     * @brief Sets up a ring for `fd`, or returns nullptr if io_uring is
+     * unavailable.
+     */
+    static std::unique_ptr<Ring> make_ring(int fd, unsigned queue_depth);
+
+    bool queue(bool write, const struct iovec &iov) const;
+
+    std::unique_ptr<Ring> ring_;
+    mutable std::vector<Op> ops_;
+};
+
+}  // namespace ipc
+}  // namespace rix
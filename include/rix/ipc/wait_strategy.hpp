@@ -0,0 +1,121 @@
+#pragma once
+
+#include <poll.h>
+
+#include <cstdint>
+
+#include "rix/util/time.hpp"
+
+namespace rix {
+namespace ipc {
+
+/**
+ * @brief Hints to the processor that the caller is spinning, which saves power
+ * and frees execution resources for a sibling hyperthread.
+ *
+ */
+inline void cpu_relax() {
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
+/**
+ * @struct WaitStats
+ * @brief Counts how the waits of an object ended. The counters are not
+ * synchronized, so an object should only be waited on from one thread at a
+ * time when its statistics are used.
+ *
+ */
+struct WaitStats {
+    uint64_t spin_wins = 0;   ///< Waits that succeeded while spinning
+    uint64_t block_wins = 0;  ///< Waits that succeeded after blocking in the kernel
+    uint64_t timeouts = 0;    ///< Waits that ended without the object being ready
+};
+
+/**
+ * @class WaitStrategy
+ * @brief Decides how to wait for a file descriptor. The waiter first spins for
+ * up to the spin budget, checking readiness and relaxing the processor between
+ * checks, and then blocks in `ppoll` with nanosecond precision for the rest of
+ * the timeout. Spinning trades processor time for not paying a scheduler
+ * wake-up when the event arrives soon. The default strategy has no spin budget
+ * and blocks immediately.
+ *
+ */
+class WaitStrategy {
+   public:
+    /**
+     * @brief Construct a strategy that blocks immediately.
+     *
+     */
+    WaitStrategy() : spin_(0) {}
+
+    /**
+     * @brief Construct a strategy that spins for up to `spin` before blocking.
+     *
+     */
+    explicit WaitStrategy(const rix::util::Duration &spin) : spin_(spin) {}
+
+    /**
+     * @brief Returns the spin budget.
+     *
+     */
+    const rix::util::Duration &spin() const { return spin_; }
+
+    /**
+     * @brief Blocks in `ppoll` until `fd` reports one of `events`, or until
+     * `timeout` elapses. `Duration::max()` waits forever.
+     *
+     * @return true if `fd` is ready, false on timeout or error
+     */
+    static bool block(int fd, short events, const rix::util::Duration &timeout);
+
+    /**
+     * @brief Waits until `fd` is ready for `events`, or until `timeout`
+     * elapses, and counts how the wait ended in `stats`.
+     *
+     * @param fd The file descriptor to block on
+     * @param events The `poll` events to block for
+     * @param timeout The maximum duration to wait
+     * @param stats The counters to update
+     * @param ready Checks readiness while spinning. It must not block.
+     * @return true if ready, false on timeout or error
+     */
+    template <typename Ready>
+    bool wait(int fd, short events, const rix::util::Duration &timeout, WaitStats &stats, Ready &&ready) const {
+        rix::util::Duration remaining = timeout;
+        if (spin_ > rix::util::Duration(0) && timeout > rix::util::Duration(0)) {
+            rix::util::Time start = rix::util::Time::monotonic_now();
+            rix::util::Duration budget = (spin_ < timeout) ? spin_ : timeout;
+            rix::util::Duration elapsed(0);
+            do {
+                if (ready()) {
+                    stats.spin_wins++;
+                    return true;
+                }
+                cpu_relax();
+                elapsed = rix::util::Time::monotonic_now() - start;
+            } while (elapsed < budget);
+
+            if (timeout != rix::util::Duration::max()) {
+                remaining = (elapsed < timeout) ? timeout - elapsed : rix::util::Duration(0);
+            }
+        }
+
+        if (block(fd, events, remaining)) {
+            stats.block_wins++;
+            return true;
+        }
+        stats.timeouts++;
+        return false;
+    }
+
+   private:
+    rix::util::Duration spin_;
+};
+
+}  // namespace ipc
+}  // namespace rix
@@ -14,7 +14,7 @@ namespace rix {
 namespace msg {
 namespace geometry {
 
-class Twist2D : public Message {
+class Twist2D final : public Message {
   public:
     float vx{};
     float vy{};
@@ -24,13 +24,10 @@ class Twist2D : public Message {
     Twist2D(const Twist2D &other) = default;
     ~Twist2D() = default;
 
+    static constexpr size_t STATIC_SIZE = static_size_v<float> + static_size_v<float> + static_size_v<float>;
+
     size_t size() const override {
-        using namespace detail;
-        size_t size = 0;
-        size += size_number(vx);
-        size += size_number(vy);
-        size += size_number(wz);
-        return size;
+        return STATIC_SIZE;
     }
 
     std::array<uint64_t, 2> hash() const override {
@@ -39,20 +36,37 @@ class Twist2D : public Message {
 
     void serialize(uint8_t *dst, size_t &offset) const override {
         using namespace detail;
-        serialize_number(dst, offset, vx);
-        serialize_number(dst, offset, vy);
-        serialize_number(dst, offset, wz);
+        serialize_numbers(dst, offset, vx, vy, wz);
     }
 
     bool deserialize(const uint8_t *src, size_t size, size_t &offset) override {
         using namespace detail;
-        if (!deserialize_number(vx, src, size, offset)) { return false; };
-        if (!deserialize_number(vy, src, size, offset)) { return false; };
-        if (!deserialize_number(wz, src, size, offset)) { return false; };
+        if (!deserialize_numbers(src, size, offset, vx, vy, wz)) { return false; };
         return true;
     }
 };
 
+/**
+ * @brief Read-only view of a serialized Twist2D. The accessors read straight
+ * from the wrapped buffer, which must outlive the view.
+ */
+class Twist2DView {
+  public:
+    Twist2DView() = default;
+
+    bool wrap(const uint8_t *src, size_t size, size_t &offset) {
+        using namespace detail;
+        return view_block(data_, Twist2D::STATIC_SIZE, src, size, offset);
+    }
+
+    float vx() const { return detail::load_number<float>(data_); }
+    float vy() const { return detail::load_number<float>(data_ + 4); }
+    float wz() const { return detail::load_number<float>(data_ + 8); }
+
+  private:
+    const uint8_t *data_{};
+};
+
 } // namespace geometry
 } // namespace msg
-} // namespace rix
\ No newline at end of file
+} // namespace rix
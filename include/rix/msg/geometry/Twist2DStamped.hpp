@@ -16,7 +16,7 @@ namespace rix {
 namespace msg {
 namespace geometry {
 
-class Twist2DStamped : public Message {
+class Twist2DStamped final : public Message {
   public:
     standard::Header header{};
     geometry::Twist2D twist{};
@@ -51,6 +51,28 @@ class Twist2DStamped : public Message {
     }
 };
 
+/**
+ * @brief Read-only view of a serialized Twist2DStamped. The accessors read
+ * straight from the wrapped buffer, which must outlive the view.
+ */
+class Twist2DStampedView {
+  public:
+    Twist2DStampedView() = default;
+
+    bool wrap(const uint8_t *src, size_t size, size_t &offset) {
+        if (!header_.wrap(src, size, offset)) { return false; };
+        if (!twist_.wrap(src, size, offset)) { return false; };
+        return true;
+    }
+
+    const standard::HeaderView &header() const { return header_; }
+    const geometry::Twist2DView &twist() const { return twist_; }
+
+  private:
+    standard::HeaderView header_{};
+    geometry::Twist2DView twist_{};
+};
+
 } // namespace geometry
 } // namespace msg
-} // namespace rix
\ No newline at end of file
+} // namespace rix
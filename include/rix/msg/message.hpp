@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <map>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 namespace rix {
@@ -17,5 +18,31 @@ class Message {
     virtual bool deserialize(const uint8_t *src, size_t size, size_t &offset) = 0;
 };
 
+/**
+ * @brief The serialized size of `T` in bytes if it is known at compile time,
+ * and 0 otherwise. Arithmetic types have a static size, and so do messages
+ * that declare a `STATIC_SIZE` member because all of their fields do.
+ *
+ */
+template <typename T, typename = void>
+struct static_size : std::integral_constant<size_t, 0> {};
+
+template <typename T>
+struct static_size<T, std::enable_if_t<std::is_arithmetic_v<T>>> : std::integral_constant<size_t, sizeof(T)> {};
+
+template <typename T>
+struct static_size<T, std::void_t<decltype(T::STATIC_SIZE)>> : std::integral_constant<size_t, T::STATIC_SIZE> {};
+
+template <typename T>
+inline constexpr size_t static_size_v = static_size<T>::value;
+
+/**
+ * @brief True if `T` serializes to `static_size_v<T>` bytes regardless of its
+ * contents.
+ *
+ */
+template <typename T>
+inline constexpr bool has_static_size_v = static_size_v<T> != 0;
+
 }  // namespace msg
 }  // namespace rix
\ No newline at end of file
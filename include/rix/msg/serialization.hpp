@@ -1,8 +1,10 @@
 #pragma once
 
 #include <array>
+#include <bit>
 #include <cstring>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -22,8 +24,14 @@ inline uint32_t size_string(const std::string &src) {
     return 4 + src.size();
 }
 
-inline uint32_t size_message(const Message &src) {
-    return src.size();
+template<typename T>
+inline uint32_t size_message(const T &src) {
+    static_assert(std::is_base_of<Message, T>::value, "T must derive from Message");
+    if constexpr (has_static_size_v<T>) {
+        return static_size_v<T>;
+    } else {
+        return src.size();
+    }
 }
 
 template<typename T, size_t N>
@@ -43,6 +51,9 @@ inline uint32_t size_string_array(const std::array<std::string, N> &src) {
 template<typename T, size_t N>
 inline uint32_t size_message_array(const std::array<T, N> &src) {
     static_assert(std::is_base_of<Message, T>::value, "T must derive from Message");
+    if constexpr (has_static_size_v<T>) {
+        return N * static_size_v<T>;
+    }
     uint32_t size = 0;
     for (const auto &m : src)
         size += size_message(m);
@@ -65,6 +76,9 @@ inline uint32_t size_string_vector(const std::vector<std::string> &src) {
 template<typename T>
 inline uint32_t size_message_vector(const std::vector<T> &src) {
     static_assert(std::is_base_of<Message, T>::value, "T must derive from Message");
+    if constexpr (has_static_size_v<T>) {
+        return 4 + src.size() * static_size_v<T>;
+    }
     uint32_t size = 4;
     for (const auto &m : src)
         size += size_message(m);
@@ -78,6 +92,104 @@ inline void serialize_number(uint8_t *dst, size_t &offset, const T &src) {
     offset += sizeof(T);
 }
 
+/**
+ * @brief Serializes consecutive arithmetic fields as one packed block. The
+ * block size is known at compile time and every copy lands at a constant
+ * offset, so the copies compile to a single block store.
+ */
+template<typename... Ts>
+inline void serialize_numbers(uint8_t *dst, size_t &offset, const Ts &...src) {
+    static_assert((std::is_arithmetic<Ts>::value && ...), "Ts must be arithmetic");
+    uint8_t *block = dst + offset;
+    size_t at = 0;
+    ((std::memcpy(block + at, &src, sizeof(Ts)), at += sizeof(Ts)), ...);
+    offset += (sizeof(Ts) + ...);
+}
+
+/**
+ * @brief Reverses the byte order of a single number of `N` bytes.
+ */
+template<size_t N>
+inline void byteswap_number(uint8_t *data) {
+    if constexpr (N == 2) {
+        uint16_t v;
+        std::memcpy(&v, data, 2);
+        v = __builtin_bswap16(v);
+        std::memcpy(data, &v, 2);
+    } else if constexpr (N == 4) {
+        uint32_t v;
+        std::memcpy(&v, data, 4);
+        v = __builtin_bswap32(v);
+        std::memcpy(data, &v, 4);
+    } else if constexpr (N == 8) {
+        uint64_t v;
+        std::memcpy(&v, data, 8);
+        v = __builtin_bswap64(v);
+        std::memcpy(data, &v, 8);
+    }
+}
+
+/**
+ * @brief Copies `n` consecutive numbers of type `T` from `src` to `dst`,
+ * reversing the byte order of each. `dst` may equal `src`. Sixteen bytes are
+ * swapped at a time with lane-wise shifts and masks, which map to plain
+ * SSE2/NEON instructions without byte shuffles.
+ */
+template<typename T>
+inline void byteswap_block(uint8_t *dst, const uint8_t *src, size_t n) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
+    typedef uint16_t u16x8 __attribute__((vector_size(16)));
+    typedef uint32_t u32x4 __attribute__((vector_size(16)));
+    typedef uint64_t u64x2 __attribute__((vector_size(16)));
+
+    size_t bytes = n * sizeof(T);
+    if constexpr (sizeof(T) == 1) {
+        std::memmove(dst, src, bytes);
+        return;
+    }
+    size_t i = 0;
+    for (; i + 16 <= bytes; i += 16) {
+        if constexpr (sizeof(T) == 2) {
+            u16x8 v;
+            std::memcpy(&v, src + i, 16);
+            v = (v >> 8) | (v << 8);
+            std::memcpy(dst + i, &v, 16);
+        } else {
+            u32x4 v;
+            std::memcpy(&v, src + i, 16);
+            v = (v >> 24) | ((v >> 8) & 0xff00) | ((v << 8) & 0xff0000) | (v << 24);
+            if constexpr (sizeof(T) == 8) {
+                // Swapping the bytes of each half, then the halves, reverses
+                // all eight
+                u64x2 w;
+                std::memcpy(&w, &v, 16);
+                w = (w >> 32) | (w << 32);
+                std::memcpy(&v, &w, 16);
+            }
+            std::memcpy(dst + i, &v, 16);
+        }
+    }
+    for (; i < bytes; i += sizeof(T)) {
+        std::memmove(dst + i, src + i, sizeof(T));
+        byteswap_number<sizeof(T)>(dst + i);
+    }
+}
+
+/**
+ * @brief Serializes `n` contiguous numbers with a single copy, byte swapping
+ * them on the way if `Order` is not the native byte order.
+ */
+template<std::endian Order = std::endian::native, typename T>
+inline void serialize_block(uint8_t *dst, size_t &offset, const T *src, size_t n) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
+    if constexpr (Order != std::endian::native) {
+        byteswap_block<T>(dst + offset, reinterpret_cast<const uint8_t*>(src), n);
+    } else {
+        std::memcpy(dst + offset, src, n * sizeof(T));
+    }
+    offset += n * sizeof(T);
+}
+
 inline void serialize_string(uint8_t *dst, size_t &offset, const std::string &src) {
     uint32_t len = src.size();
     serialize_number(dst, offset, len);
@@ -85,15 +197,16 @@ inline void serialize_string(uint8_t *dst, size_t &offset, const std::string &sr
     offset += len;
 }
 
-inline void serialize_message(uint8_t *dst, size_t &offset, const Message &src) {
+template<typename T>
+inline void serialize_message(uint8_t *dst, size_t &offset, const T &src) {
+    static_assert(std::is_base_of<Message, T>::value, "T must derive from Message");
     src.serialize(dst, offset);
     // offset is already updated by src.serialize()
 }
 
-template<typename T, size_t N>
+template<std::endian Order = std::endian::native, typename T, size_t N>
 inline void serialize_number_array(uint8_t *dst, size_t &offset, const std::array<T, N> &src) {
-    for (const auto &v : src)
-        serialize_number(dst, offset, v);
+    serialize_block<Order>(dst, offset, src.data(), N);
 }
 
 template<size_t N>
@@ -109,13 +222,18 @@ inline void serialize_message_array(uint8_t *dst, size_t &offset, const std::arr
         serialize_message(dst, offset, m);
 }
 
-template<typename T>
+template<std::endian Order = std::endian::native, typename T>
 inline void serialize_number_vector(uint8_t *dst, size_t &offset, const std::vector<T> &src) {
     static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
     uint32_t len = src.size();
-    serialize_number(dst, offset, len);
-    for (const auto &v : src)
-        serialize_number(dst, offset, v);
+    serialize_block<Order>(dst, offset, &len, 1);
+    if constexpr (std::is_same<T, bool>::value) {
+        // std::vector<bool> is bit-packed, so it is copied element by element
+        for (bool v : src)
+            serialize_number(dst, offset, v);
+    } else {
+        serialize_block<Order>(dst, offset, src.data(), len);
+    }
 }
 
 inline void serialize_string_vector(uint8_t *dst, size_t &offset, const std::vector<std::string> &src) {
@@ -144,6 +262,42 @@ inline bool deserialize_number(T &dst, const uint8_t *src, size_t size, size_t &
     return true;
 }
 
+/**
+ * @brief Deserializes consecutive arithmetic fields from one packed block with
+ * a single bounds check. On failure, no field is modified.
+ */
+template<typename... Ts>
+inline bool deserialize_numbers(const uint8_t *src, size_t size, size_t &offset, Ts &...dst) {
+    static_assert((std::is_arithmetic<Ts>::value && ...), "Ts must be arithmetic");
+    constexpr size_t block_size = (sizeof(Ts) + ...);
+    if (offset + block_size > size)
+        return false;
+    const uint8_t *block = src + offset;
+    size_t at = 0;
+    ((std::memcpy(&dst, block + at, sizeof(Ts)), at += sizeof(Ts)), ...);
+    offset += block_size;
+    return true;
+}
+
+/**
+ * @brief Deserializes `n` contiguous numbers with one bounds check and a single
+ * copy, byte swapping them if `Order` is not the native byte order. On failure,
+ * `dst` is not modified.
+ */
+template<std::endian Order = std::endian::native, typename T>
+inline bool deserialize_block(T *dst, size_t n, const uint8_t *src, size_t size, size_t &offset) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
+    if (offset > size || n > (size - offset) / sizeof(T))
+        return false;
+    if constexpr (Order != std::endian::native) {
+        byteswap_block<T>(reinterpret_cast<uint8_t*>(dst), src + offset, n);
+    } else {
+        std::memcpy(dst, src + offset, n * sizeof(T));
+    }
+    offset += n * sizeof(T);
+    return true;
+}
+
 inline bool deserialize_string(std::string &dst, const uint8_t *src, size_t size, size_t &offset) {
     uint32_t len;
     if (!deserialize_number(len, src, size, offset))
@@ -155,7 +309,9 @@ inline bool deserialize_string(std::string &dst, const uint8_t *src, size_t size
     return true;
 }
 
-inline bool deserialize_message(Message &dst, const uint8_t *src, size_t size, size_t &offset) {
+template<typename T>
+inline bool deserialize_message(T &dst, const uint8_t *src, size_t size, size_t &offset) {
+    static_assert(std::is_base_of<Message, T>::value, "T must derive from Message");
     size_t consumed = dst.deserialize(src, size, offset);
     if (consumed == 0)
         return false;
@@ -163,13 +319,9 @@ inline bool deserialize_message(Message &dst, const uint8_t *src, size_t size, s
     return true;
 }
 
-template<typename T, size_t N>
+template<std::endian Order = std::endian::native, typename T, size_t N>
 inline bool deserialize_number_array(std::array<T, N> &dst, const uint8_t *src, size_t size, size_t &offset) {
-    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
-    for (auto &v : dst)
-        if (!deserialize_number(v, src, size, offset))
-            return false;
-    return true;
+    return deserialize_block<Order>(dst.data(), N, src, size, offset);
 }
 
 template<size_t N>
@@ -190,22 +342,28 @@ inline bool deserialize_message_array(std::array<T, N> &dst, const uint8_t *src,
     return true;
 }
 
-template<typename T>
+template<std::endian Order = std::endian::native, typename T>
 inline bool deserialize_number_vector(std::vector<T> &dst, const uint8_t *src, size_t size, size_t &offset) {
     static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
     uint32_t len;
-    if (!deserialize_number(len, src, size, offset))
+    if (!deserialize_block<Order>(&len, 1, src, size, offset))
         return false;
-    
-    dst.clear();
-    dst.reserve(len);
-    for (uint32_t i = 0; i < len; ++i) {
-        T v;
-        if (!deserialize_number(v, src, size, offset))
-            return false;
-        dst.push_back(v);
+    if (len > (size - offset) / sizeof(T))
+        return false;
+
+    if constexpr (std::is_same<T, bool>::value) {
+        // std::vector<bool> is bit-packed, so it is filled element by element
+        dst.assign(len, false);
+        for (uint32_t i = 0; i < len; ++i) {
+            bool v;
+            deserialize_number(v, src, size, offset);
+            dst[i] = v;
+        }
+        return true;
+    } else {
+        dst.resize(len);
+        return deserialize_block<Order>(dst.data(), len, src, size, offset);
     }
-    return true;
 }
 
 inline bool deserialize_string_vector(std::vector<std::string> &dst, const uint8_t *src, size_t size, size_t &offset) {
@@ -242,6 +400,45 @@ inline bool deserialize_message_vector(std::vector<T> &dst, const uint8_t *src,
     return true;
 }
 
+/**
+ * @brief Reads a number from a serialized buffer without bounds checks. Used
+ * by message views after the block has been validated.
+ */
+template<typename T>
+inline T load_number(const uint8_t *src) {
+    static_assert(std::is_arithmetic<T>::value, "T must be arithmetic");
+    T dst;
+    std::memcpy(&dst, src, sizeof(T));
+    return dst;
+}
+
+/**
+ * @brief Validates that `len` bytes are available at `offset` and points
+ * `dst` at them without copying.
+ */
+inline bool view_block(const uint8_t *&dst, size_t len, const uint8_t *src, size_t size, size_t &offset) {
+    if (offset + len > size)
+        return false;
+    dst = src + offset;
+    offset += len;
+    return true;
+}
+
+/**
+ * @brief Validates a serialized string and points `dst` at its characters
+ * without copying.
+ */
+inline bool view_string(std::string_view &dst, const uint8_t *src, size_t size, size_t &offset) {
+    uint32_t len;
+    if (!deserialize_number(len, src, size, offset))
+        return false;
+    if (offset + len > size)
+        return false;
+    dst = std::string_view(reinterpret_cast<const char*>(src + offset), len);
+    offset += len;
+    return true;
+}
+
 }  // namespace detail
 }  // namespace msg
 }  // namespace rix
\ No newline at end of file
@@ -15,7 +15,7 @@ namespace rix {
 namespace msg {
 namespace standard {
 
-class Header : public Message {
+class Header final : public Message {
   public:
     uint32_t seq{};
     standard::Time stamp{};
@@ -54,6 +54,32 @@ class Header : public Message {
     }
 };
 
+/**
+ * @brief Read-only view of a serialized Header. Strings are returned as
+ * `std::string_view`s into the wrapped buffer, which must outlive the view.
+ */
+class HeaderView {
+  public:
+    HeaderView() = default;
+
+    bool wrap(const uint8_t *src, size_t size, size_t &offset) {
+        using namespace detail;
+        if (!view_block(seq_, static_size_v<uint32_t>, src, size, offset)) { return false; };
+        if (!stamp_.wrap(src, size, offset)) { return false; };
+        if (!view_string(frame_id_, src, size, offset)) { return false; };
+        return true;
+    }
+
+    uint32_t seq() const { return detail::load_number<uint32_t>(seq_); }
+    const standard::TimeView &stamp() const { return stamp_; }
+    std::string_view frame_id() const { return frame_id_; }
+
+  private:
+    const uint8_t *seq_{};
+    standard::TimeView stamp_{};
+    std::string_view frame_id_{};
+};
+
 } // namespace standard
 } // namespace msg
-} // namespace rix
\ No newline at end of file
+} // namespace rix
@@ -14,7 +14,7 @@ namespace rix {
 namespace msg {
 namespace standard {
 
-class Time : public Message {
+class Time final : public Message {
   public:
     int32_t sec{};
     int32_t nsec{};
@@ -23,12 +23,10 @@ class Time : public Message {
     Time(const Time &other) = default;
     ~Time() = default;
 
+    static constexpr size_t STATIC_SIZE = static_size_v<int32_t> + static_size_v<int32_t>;
+
     size_t size() const override {
-        using namespace detail;
-        size_t size = 0;
-        size += size_number(sec);
-        size += size_number(nsec);
-        return size;
+        return STATIC_SIZE;
     }
 
     std::array<uint64_t, 2> hash() const override {
@@ -37,18 +35,36 @@ class Time : public Message {
 
     void serialize(uint8_t *dst, size_t &offset) const override {
         using namespace detail;
-        serialize_number(dst, offset, sec);
-        serialize_number(dst, offset, nsec);
+        serialize_numbers(dst, offset, sec, nsec);
     }
 
     bool deserialize(const uint8_t *src, size_t size, size_t &offset) override {
         using namespace detail;
-        if (!deserialize_number(sec, src, size, offset)) { return false; };
-        if (!deserialize_number(nsec, src, size, offset)) { return false; };
+        if (!deserialize_numbers(src, size, offset, sec, nsec)) { return false; };
         return true;
     }
 };
 
+/**
+ * @brief Read-only view of a serialized Time. The accessors read straight from
+ * the wrapped buffer, which must outlive the view.
+ */
+class TimeView {
+  public:
+    TimeView() = default;
+
+    bool wrap(const uint8_t *src, size_t size, size_t &offset) {
+        using namespace detail;
+        return view_block(data_, Time::STATIC_SIZE, src, size, offset);
+    }
+
+    int32_t sec() const { return detail::load_number<int32_t>(data_); }
+    int32_t nsec() const { return detail::load_number<int32_t>(data_ + 4); }
+
+  private:
+    const uint8_t *data_{};
+};
+
 } // namespace standard
 } // namespace msg
-} // namespace rix
\ No newline at end of file
+} // namespace rix
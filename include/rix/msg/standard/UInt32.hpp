@@ -14,7 +14,7 @@ namespace rix {
 namespace msg {
 namespace standard {
 
-class UInt32 : public Message {
+class UInt32 final : public Message {
   public:
     uint32_t data{};
 
@@ -22,11 +22,10 @@ class UInt32 : public Message {
     UInt32(const UInt32 &other) = default;
     ~UInt32() = default;
 
+    static constexpr size_t STATIC_SIZE = static_size_v<uint32_t>;
+
     size_t size() const override {
-        using namespace detail;
-        size_t size = 0;
-        size += size_number(data);
-        return size;
+        return STATIC_SIZE;
     }
 
     std::array<uint64_t, 2> hash() const override {
@@ -45,6 +44,25 @@ class UInt32 : public Message {
     }
 };
 
+/**
+ * @brief Read-only view of a serialized UInt32. The accessors read straight
+ * from the wrapped buffer, which must outlive the view.
+ */
+class UInt32View {
+  public:
+    UInt32View() = default;
+
+    bool wrap(const uint8_t *src, size_t size, size_t &offset) {
+        using namespace detail;
+        return view_block(data_, UInt32::STATIC_SIZE, src, size, offset);
+    }
+
+    uint32_t data() const { return detail::load_number<uint32_t>(data_); }
+
+  private:
+    const uint8_t *data_{};
+};
+
 } // namespace standard
 } // namespace msg
-} // namespace rix
\ No newline at end of file
+} // namespace rix
@@ -18,6 +18,15 @@ class Time {
    public:
     using Type = std::chrono::time_point<Clock, std::chrono::nanoseconds>;
     static Time now();
+
+    /**
+     * @brief Returns the current time on the steady clock, counted from an
+     * unspecified epoch. Deadlines for `remaining` and the `wait_until`
+     * functions are taken from this clock so that they do not move when the
+     * wall clock is set. It cannot be compared with `now`.
+     */
+    static Time monotonic_now();
+
     static Time max() { return Time(Clock::time_point::max()); }
     static Time min() { return Time(Clock::time_point::min()); }
 
@@ -46,6 +55,13 @@ class Time {
     std::string to_string(bool local_time = false) const;
     rix::msg::standard::Time to_msg();
 
+    /**
+     * @brief Returns the duration from `monotonic_now` until this deadline, 0
+     * if the deadline has passed, or `Duration::max()` if this time is
+     * `Time::max()`.
+     */
+    Duration remaining() const;
+
     enum RoundType { FLOOR = 0, CEIL, NEAREST };
 
     int64_t to_seconds(RoundType type = RoundType::FLOOR) const;
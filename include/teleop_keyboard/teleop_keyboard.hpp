@@ -2,6 +2,7 @@
 
 #include <memory>
 
+#include "rix/ipc/coro.hpp"
 #include "rix/ipc/fifo.hpp"
 #include "rix/ipc/file.hpp"
 #include "rix/ipc/signal.hpp"
@@ -22,9 +23,26 @@ class TeleopKeyboard {
 
     void spin(std::unique_ptr<rix::ipc::interfaces::Notification> notif);
 
+    /**
+     * @brief Same as `spin`, but reads keys and waits for `notif` in two
+     * coroutines on a single-threaded `coro::Scheduler`.
+     *
+     * @param notif The notification that stops teleop
+     */
+    void spin_async(std::unique_ptr<rix::ipc::interfaces::Notification> notif);
+
    private:
+    /**
+     * @brief Sends the drive command bound to `key`. Returns `false` if no
+     * command is bound to `key` or the write fails.
+     */
+    bool send_key(char key);
+
+    rix::ipc::coro::Task<void> read_keys(rix::ipc::coro::Scheduler &scheduler);
+
     std::unique_ptr<rix::ipc::interfaces::IO> input;
     std::unique_ptr<rix::ipc::interfaces::IO> output;
     double linear_speed;
     double angular_speed;
+    uint32_t seq;
 };
\ No newline at end of file
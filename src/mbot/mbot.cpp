@@ -28,8 +28,8 @@ MBot::MBot() : file("/dev/mbot_lcm", O_RDWR | O_NOCTTY | O_NDELAY, 0) {
 }
 
 MBot::~MBot() {
-    // Set the stop flag for the time synchronization thread
-    stop_timesync_flag = 1;
+    // Wake the time synchronization thread and tell it to stop
+    stop_timesync.raise();
 
     // Join the time synchronization thread
     if (timesync_thr.joinable()) {
@@ -60,8 +60,17 @@ void MBot::drive(const Twist2DStamped &cmd) const {
 void MBot::timesync() {
     int status;
 
+    // Run at 2 Hz, waking immediately when asked to stop
+    rix::ipc::TimerFd timer;
+    rix::ipc::Poller poller;
+    if (!timer.start(rix::util::Duration(0.5), rix::util::Duration(0.5)) || !poller.add(timer) ||
+        !poller.add(stop_timesync)) {
+        perror("timesync");
+        return;
+    }
+
     // Time synchronization loop
-    while (!stop_timesync_flag) {
+    while (true) {
         // Encode the timesync message
         serial_timestamp_t msg = {0};
         struct timespec ts;
@@ -83,7 +92,11 @@ void MBot::timesync() {
             break;
         }
 
-        // Run at 2 Hz
-        usleep(500000);
+        // Wait for the next period or the stop event
+        poller.wait(rix::util::Duration::max());
+        if (stop_timesync.is_ready()) {
+            break;
+        }
+        timer.is_ready();
     }
 }
\ No newline at end of file
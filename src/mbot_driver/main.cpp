@@ -9,19 +9,95 @@
 #include "rix/ipc/signal.hpp"
 #include "rix/msg/geometry/Twist2DStamped.hpp"
 #include "rix/msg/standard/UInt32.hpp"
+#include "rix/util/argument_parser.hpp"
 
 using namespace rix::ipc;
 using namespace rix::msg;
+using namespace rix::util;
+
+int main(int argc, char **argv) {
+    ArgumentParser parser("mbot_driver", "Drives the MBot with commands read from stdin.");
+    parser.add<int>("pipe_capacity", "Capacity of the stdin pipe in bytes (0 keeps the default)", 'c', 0);
+    parser.add<std::string>("socket", "Serve clients on this local socket path instead of reading stdin", 's', "");
+    parser.add<int>("udp_port", "Receive commands on this UDP port instead of reading stdin (0 disables)", 'u', 0);
+    parser.add<double>("cycle", "Apply only the newest command once per cycle of this many seconds (0 applies every command)", 't', 0.0);
+    parser.add<std::string>("group", "Multicast group to join when receiving over UDP", 'g', "");
+
+    if (!parser.parse(argc, argv)) {
+        std::cerr << parser.help() << std::endl;
+        return 1;
+    }
+
+    int pipe_capacity;
+    if (!parser.get<int>("pipe_capacity", pipe_capacity)) {
+        std::cerr << "Failed to get pipe_capacity argument." << std::endl;
+        return 1;
+    }
+
+    std::string socket_path;
+    if (!parser.get<std::string>("socket", socket_path)) {
+        std::cerr << "Failed to get socket argument." << std::endl;
+        return 1;
+    }
+
+    int udp_port;
+    if (!parser.get<int>("udp_port", udp_port)) {
+        std::cerr << "Failed to get udp_port argument." << std::endl;
+        return 1;
+    }
+
+    std::string group;
+    if (!parser.get<std::string>("group", group)) {
+        std::cerr << "Failed to get group argument." << std::endl;
+        return 1;
+    }
+
+    double cycle;
+    if (!parser.get<double>("cycle", cycle)) {
+        std::cerr << "Failed to get cycle argument." << std::endl;
+        return 1;
+    }
 
-int main() {
     auto mbot = std::make_unique<MBot>();
     if (!mbot->ok()) {
         return 1;
     }
 
     auto input = std::make_unique<File>(STDIN_FILENO);
+
+    // A small pipe bounds how many commands can queue up, and therefore how
+    // late they can reach the robot, when the driver falls behind
+    if (pipe_capacity > 0 && input->set_capacity(pipe_capacity) < 0) {
+        std::cerr << "Failed to set the stdin pipe capacity." << std::endl;
+    }
     auto sig = std::make_unique<Signal>(SIGINT);
 
     MBotDriver driver(std::move(input), std::move(mbot));
+    if (!socket_path.empty()) {
+        UnixListener listener(socket_path);
+        if (!listener.ok()) {
+            std::cerr << "Failed to listen on " << socket_path << "." << std::endl;
+            return 1;
+        }
+        driver.serve(listener, std::move(sig));
+        return 0;
+    }
+    if (udp_port > 0) {
+        UdpSocket socket("0.0.0.0", udp_port);
+        if (!socket.ok() || (!group.empty() && !socket.join_group(group))) {
+            std::cerr << "Failed to receive on UDP port " << udp_port << "." << std::endl;
+            return 1;
+        }
+
+        // Both are best effort and need privileges or driver support
+        socket.set_busy_poll(50);
+        socket.set_low_latency();
+        driver.serve(socket, std::move(sig));
+        return 0;
+    }
+    if (cycle > 0.0) {
+        driver.spin(std::move(sig), Duration(cycle));
+        return 0;
+    }
     driver.spin(std::move(sig)); 
 }
\ No newline at end of file
@@ -1,62 +1,300 @@
 #include "mbot_driver/mbot_driver.hpp"
 
+#include <algorithm>
+#include <cerrno>
+#include <map>
 #include <vector>
 
+#include "rix/ipc/buffered_reader.hpp"
+#include "rix/ipc/poller.hpp"
+
 using namespace rix::ipc;
 using namespace rix::msg;
 
+namespace {
+
+// Reads the command straight from the frame through a view. The frame id is
+// not used by the MBot, so it is left empty and nothing is allocated.
+bool decode_command(const uint8_t *src, size_t size, size_t offset, geometry::Twist2DStamped &cmd) {
+    geometry::Twist2DStampedView view;
+    if (!view.wrap(src, size, offset)) {
+        return false;
+    }
+
+    cmd.header.seq = view.header().seq();
+    cmd.header.stamp.sec = view.header().stamp().sec();
+    cmd.header.stamp.nsec = view.header().stamp().nsec();
+    cmd.twist.vx = view.twist().vx();
+    cmd.twist.vy = view.twist().vy();
+    cmd.twist.wz = view.twist().wz();
+    return true;
+}
+
+}  // namespace
+
 MBotDriver::MBotDriver(std::unique_ptr<interfaces::IO> input, std::unique_ptr<MBotBase> mbot)
-    : input(std::move(input)), mbot(std::move(mbot)) {}
+    : input(std::move(input)), mbot(std::move(mbot)), overruns_(0) {}
 
 void MBotDriver::spin(std::unique_ptr<interfaces::Notification> notif) {
-    std::vector<uint8_t> size_buffer(4);
+    BufferedReader reader(*input);
+    std::vector<uint8_t> msg_buffer;
+    
+    // Sleep in a single kernel wait on both the input and the notification
+    // when both are pollable
+    Poller poller;
+    bool pollable = poller.add(*input) && poller.add(*notif);
     
     while (true) {
+        bool readable = true;
+        if (pollable && !reader.has_frame()) {
+            const auto &events = poller.wait(rix::util::Duration::max());
+            readable = std::any_of(events.begin(), events.end(),
+                                   [this](const Poller::Event &event) { return event.fd == input->fd(); });
+        }
+
         if (notif->is_ready()) {
             geometry::Twist2DStamped stop_cmd;
-            mbot->drive(stop_cmd);  
+            mbot->drive(stop_cmd);
             return;
         }
-        
-        ssize_t bytes_read = input->read(size_buffer.data(), size_buffer.size());
-        
-        if (bytes_read == 0) {
+
+        // One read per wakeup, so a sender that stalls partway through a
+        // frame never blocks the driver
+        if (readable && !reader.has_frame()) {
+            ssize_t bytes_read = reader.fill();
+            if (bytes_read == 0) {
+                geometry::Twist2DStamped stop_cmd;
+                mbot->drive(stop_cmd);
+                return;
+            }
+        }
+
+        // Buffered frames are applied one per iteration so that the
+        // notification is checked between them
+        if (reader.next_frame(msg_buffer)) {
+            geometry::Twist2DStamped twist_cmd;
+            if (decode_command(msg_buffer.data(), msg_buffer.size(), 0, twist_cmd)) {
+                mbot->drive(twist_cmd);
+            }
+        }
+    }
+}
+
+void MBotDriver::spin_async(std::unique_ptr<interfaces::Notification> notif) {
+    coro::Scheduler scheduler;
+    scheduler.spawn(drive_commands(scheduler));
+    scheduler.spawn([](const interfaces::Notification &notif, coro::Scheduler &scheduler) -> coro::Task<void> {
+        co_await coro::async_wait(notif);
+        scheduler.stop();
+    }(*notif, scheduler));
+    scheduler.run();
+
+    geometry::Twist2DStamped stop_cmd;
+    mbot->drive(stop_cmd);
+}
+
+coro::Task<void> MBotDriver::drive_commands(coro::Scheduler &scheduler) {
+    BufferedReader reader(*input);
+    std::vector<uint8_t> msg_buffer;
+
+    while (true) {
+        // Each fill is a single read, so it cannot block once the input is
+        // readable. A frame that can never fit is discarded by next_frame,
+        // and the rest of it is skipped by the following fills.
+        while (!reader.next_frame(msg_buffer)) {
+            co_await coro::readable(*input);
+            ssize_t bytes_read = reader.fill();
+            if (bytes_read == 0 || (bytes_read < 0 && errno != EAGAIN && errno != EINTR)) {
+                scheduler.stop();
+                co_return;
+            }
+        }
+
+        geometry::Twist2DStamped twist_cmd;
+        if (decode_command(msg_buffer.data(), msg_buffer.size(), 0, twist_cmd)) {
+            mbot->drive(twist_cmd);
+        }
+    }
+}
+
+void MBotDriver::spin(std::unique_ptr<interfaces::Notification> notif, const rix::util::Duration &cycle) {
+    BufferedReader reader(*input);
+    std::vector<uint8_t> msg_buffer;
+
+    Poller poller;
+    bool pollable = poller.add(*input) && poller.add(*notif);
+
+    rix::util::Time deadline = rix::util::Time::monotonic_now() + cycle;
+    while (true) {
+        // Read until the deadline, keeping only the newest command
+        geometry::Twist2DStamped newest;
+        bool has_cmd = false;
+        bool eof = false;
+        while (!eof) {
+            // Input that never pauses would otherwise keep this loop reading
+            // past the deadline
+            if (rix::util::Time::monotonic_now() >= deadline) {
+                break;
+            }
+
+            // A frame that fails to decode leaves the previous command intact
+            if (reader.next_frame(msg_buffer)) {
+                if (decode_command(msg_buffer.data(), msg_buffer.size(), 0, newest)) {
+                    has_cmd = true;
+                }
+                continue;
+            }
+
+            bool readable = false;
+            if (pollable) {
+                const auto &events = poller.wait_until(deadline);
+                readable = std::any_of(events.begin(), events.end(),
+                                       [this](const Poller::Event &event) { return event.fd == input->fd(); });
+            } else {
+                // A wait that ends early without data reports a hangup or an
+                // error, which the read below picks up without blocking
+                readable = input->wait_until_readable(deadline) || rix::util::Time::monotonic_now() < deadline;
+            }
+
+            if (notif->is_ready()) {
+                geometry::Twist2DStamped stop_cmd;
+                mbot->drive(stop_cmd);
+                return;
+            }
+
+            // One read per wakeup, so a partial frame waits for the next
+            // wakeup instead of holding the loop past the deadline
+            if (readable && reader.fill() == 0) {
+                eof = true;
+            }
+        }
+
+        if (has_cmd) {
+            mbot->drive(newest);
+        }
+
+        if (eof) {
             geometry::Twist2DStamped stop_cmd;
-            mbot->drive(stop_cmd);  
+            mbot->drive(stop_cmd);
             return;
         }
-        
-        if (bytes_read < 0) {
-            continue;
-        }
-        
-        standard::UInt32 size_msg;
-        size_t offset = 0;
-        if (!size_msg.deserialize(size_buffer.data(), size_buffer.size(), offset)) {
-            continue;
-        }
-        
-        uint32_t msg_size = size_msg.data;
-        
-        std::vector<uint8_t> msg_buffer(msg_size);
-        bytes_read = input->read(msg_buffer.data(), msg_buffer.size());
-        
-        if (bytes_read == 0) {
+
+        // Skip the deadlines that have already passed instead of running
+        // several cycles back to back
+        deadline += cycle;
+        rix::util::Time now = rix::util::Time::monotonic_now();
+        while (deadline <= now) {
+            deadline += cycle;
+            overruns_++;
+        }
+    }
+}
+
+size_t MBotDriver::overruns() const { return overruns_; }
+
+void MBotDriver::serve(const UnixListener &listener, std::unique_ptr<interfaces::Notification> notif) {
+    Poller poller;
+    if (!poller.add(listener) || !poller.add(*notif)) {
+        geometry::Twist2DStamped stop_cmd;
+        mbot->drive(stop_cmd);
+        return;
+    }
+
+    std::map<int, UnixSocket> clients;
+    std::vector<std::vector<uint8_t>> messages;
+
+    while (true) {
+        const auto &events = poller.wait(rix::util::Duration::max());
+
+        // Commands that are already queued are applied before stopping
+        for (const auto &event : events) {
+            if (event.fd == listener.fd()) {
+                UnixSocket client = listener.accept(true);
+                if (client.ok() && poller.add(client)) {
+                    int fd = client.fd();
+                    clients.emplace(fd, std::move(client));
+                }
+                continue;
+            }
+
+            auto it = clients.find(event.fd);
+            if (it == clients.end()) {
+                continue;
+            }
+
+            int n = it->second.recv_batch(messages);
+            if (n == 0 || (n < 0 && errno != EAGAIN && errno != EINTR)) {
+                poller.remove(it->second);
+                clients.erase(it);
+                if (clients.empty()) {
+                    geometry::Twist2DStamped stop_cmd;
+                    mbot->drive(stop_cmd);
+                }
+                continue;
+            }
+
+            for (int i = 0; i < n; i++) {
+                drive_frame(messages[i]);
+            }
+        }
+
+        if (notif->is_ready()) {
             geometry::Twist2DStamped stop_cmd;
-            mbot->drive(stop_cmd);  
+            mbot->drive(stop_cmd);
             return;
         }
-        
-        if (bytes_read < 0) {
-            continue;
+    }
+}
+
+size_t MBotDriver::serve(const UdpSocket &socket, std::unique_ptr<interfaces::Notification> notif) {
+    SequenceFilter filter;
+    Poller poller;
+    if (!poller.add(socket) || !poller.add(*notif)) {
+        geometry::Twist2DStamped stop_cmd;
+        mbot->drive(stop_cmd);
+        return filter.dropped();
+    }
+
+    std::vector<std::vector<uint8_t>> messages;
+    while (true) {
+        const auto &events = poller.wait(rix::util::Duration::max());
+
+        // Drain every queued datagram with one call per wakeup
+        for (const auto &event : events) {
+            if (event.fd != socket.fd()) {
+                continue;
+            }
+
+            int n = socket.recv_batch(messages);
+            for (int i = 0; i < n; i++) {
+                drive_frame(messages[i], &filter);
+            }
         }
-        
-        geometry::Twist2DStamped twist_cmd;
-        offset = 0;
-        if (!twist_cmd.deserialize(msg_buffer.data(), msg_buffer.size(), offset)) {
-            continue;
+
+        if (notif->is_ready()) {
+            geometry::Twist2DStamped stop_cmd;
+            mbot->drive(stop_cmd);
+            return filter.dropped();
         }
-        
-        mbot->drive(twist_cmd);
     }
 }
+
+bool MBotDriver::drive_frame(const std::vector<uint8_t> &frame, SequenceFilter *filter) {
+    standard::UInt32View size_msg;
+    size_t offset = 0;
+    if (!size_msg.wrap(frame.data(), frame.size(), offset) || size_msg.data() != frame.size() - offset) {
+        return false;
+    }
+
+    geometry::Twist2DStamped twist_cmd;
+    if (!decode_command(frame.data(), frame.size(), offset, twist_cmd)) {
+        return false;
+    }
+
+    if (filter && !filter->accept(twist_cmd.header.seq, rix::util::Time(twist_cmd.header.stamp))) {
+        return false;
+    }
+
+    mbot->drive(twist_cmd);
+    return true;
+}
@@ -0,0 +1,85 @@
+#include <iostream>
+#include <thread>
+
+#include "rix/ipc/file.hpp"
+#include "rix/ipc/poller.hpp"
+#include "rix/ipc/relay.hpp"
+#include "rix/ipc/signal.hpp"
+#include "rix/util/argument_parser.hpp"
+
+using namespace rix::ipc;
+using namespace rix::util;
+
+int main(int argc, char **argv) {
+    ArgumentParser parser("relay",
+                          "Forwards stdin to stdout without copying, optionally mirroring it to a recording file.");
+    parser.add<std::string>("record", "File to mirror the stream to (empty disables recording)", 'r', "");
+    parser.add<int>("record_capacity", "Bytes the recording may fall behind before data is dropped", 'c', 1 << 20);
+
+    if (!parser.parse(argc, argv)) {
+        std::cerr << parser.help() << std::endl;
+        return 1;
+    }
+
+    std::string record_path;
+    if (!parser.get<std::string>("record", record_path)) {
+        std::cerr << "Failed to get record argument." << std::endl;
+        return 1;
+    }
+
+    int record_capacity;
+    if (!parser.get<int>("record_capacity", record_capacity)) {
+        std::cerr << "Failed to get record_capacity argument." << std::endl;
+        return 1;
+    }
+
+    File input(STDIN_FILENO);
+    File output(STDOUT_FILENO);
+    File recording;
+    if (!record_path.empty()) {
+        recording = File(record_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        if (!recording.ok()) {
+            std::cerr << "Failed to open " << record_path << "." << std::endl;
+            return 1;
+        }
+    }
+
+    Relay relay = recording.ok() ? Relay(input, output, recording, record_capacity) : Relay(input, output);
+    if (!relay.ok()) {
+        std::cerr << "Failed to set up the relay." << std::endl;
+        return 1;
+    }
+
+    // The recording is written on its own thread so that a slow disk never
+    // delays the live output
+    std::thread recorder;
+    if (relay.is_recording()) {
+        recorder = std::thread([&relay]() {
+            while (relay.record() > 0) {
+            }
+        });
+    }
+
+    Signal sig(SIGINT);
+    Poller poller;
+    bool pollable = poller.add(input) && poller.add(sig);
+    while (true) {
+        if (pollable) {
+            poller.wait(Duration::max());
+        }
+        if (sig.is_ready()) {
+            break;
+        }
+        if (relay.forward() <= 0) {
+            break;
+        }
+    }
+
+    relay.finish();
+    if (recorder.joinable()) {
+        recorder.join();
+    }
+    if (relay.dropped() > 0) {
+        std::cerr << "Dropped " << relay.dropped() << " bytes from the recording." << std::endl;
+    }
+}
@@ -0,0 +1,142 @@
+#include "rix/ipc/buffered_reader.hpp"
+
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include "rix/msg/standard/UInt32.hpp"
+
+namespace rix {
+namespace ipc {
+
+BufferedReader::BufferedReader(const interfaces::IO &io, size_t capacity)
+    : io_(io), buffer_(std::max(capacity, PREFIX_SIZE + 1)), head_(0), size_(0), skip_(0) {}
+
+ssize_t BufferedReader::fill() {
+    const size_t cap = buffer_.size();
+    const size_t free = cap - size_;
+    if (free == 0) {
+        return -1;
+    }
+
+    // The free space starts at the write position and may wrap around the end
+    // of the buffer, in which case both regions are filled in one syscall.
+    const size_t tail = (head_ + size_) % cap;
+    struct iovec iov[2];
+    int iovcnt = 1;
+    iov[0].iov_base = buffer_.data() + tail;
+    iov[0].iov_len = std::min(free, cap - tail);
+    if (iov[0].iov_len < free) {
+        iov[1].iov_base = buffer_.data();
+        iov[1].iov_len = free - iov[0].iov_len;
+        iovcnt = 2;
+    }
+
+    ssize_t n = (iovcnt == 1) ? io_.read(static_cast<uint8_t *>(iov[0].iov_base), iov[0].iov_len)
+                              : io_.readv(iov, iovcnt);
+    if (n > 0) {
+        size_ += n;
+        if (skip_ > 0) {
+            // The payload of a rejected frame is dropped before the next
+            // prefix is parsed
+            const size_t len = std::min(skip_, size_);
+            consume(len);
+            skip_ -= len;
+        }
+    }
+    return n;
+}
+
+bool BufferedReader::has_frame() const {
+    size_t frame_size = pending_frame_size();
+    return frame_size > 0 && frame_size <= size_;
+}
+
+bool BufferedReader::next_frame(std::vector<uint8_t> &frame) {
+    if (!has_frame()) {
+        if (discard_oversized()) {
+            errno = EMSGSIZE;
+        }
+        return false;
+    }
+
+    size_t frame_size = pending_frame_size();
+    consume(PREFIX_SIZE);
+    frame.resize(frame_size - PREFIX_SIZE);
+    peek(frame.data(), frame.size());
+    consume(frame.size());
+    return true;
+}
+
+ssize_t BufferedReader::read_frame(std::vector<uint8_t> &frame) {
+    while (!has_frame()) {
+        if (discard_oversized()) {
+            errno = EMSGSIZE;
+            return -1;
+        }
+
+        ssize_t n = fill();
+        if (n <= 0) {
+            return n;
+        }
+    }
+    next_frame(frame);
+    return PREFIX_SIZE + frame.size();
+}
+
+size_t BufferedReader::size() const { return size_; }
+
+size_t BufferedReader::capacity() const { return buffer_.size(); }
+
+void BufferedReader::clear() {
+    head_ = 0;
+    size_ = 0;
+    skip_ = 0;
+}
+
+void BufferedReader::peek(uint8_t *dst, size_t len) const {
+    const size_t first = std::min(len, buffer_.size() - head_);
+    std::memcpy(dst, buffer_.data() + head_, first);
+    std::memcpy(dst + first, buffer_.data(), len - first);
+}
+
+void BufferedReader::consume(size_t len) {
+    head_ = (head_ + len) % buffer_.size();
+    size_ -= len;
+    if (size_ == 0) {
+        // Keep the next fill contiguous whenever possible
+        head_ = 0;
+    }
+}
+
+bool BufferedReader::discard_oversized() {
+    const size_t frame_size = pending_frame_size();
+    if (frame_size <= buffer_.size()) {
+        return false;
+    }
+
+    // The frame can never fit, so skip over it to the next prefix
+    const size_t buffered = size_;
+    clear();
+    skip_ = frame_size - buffered;
+    return true;
+}
+
+size_t BufferedReader::pending_frame_size() const {
+    if (size_ < PREFIX_SIZE) {
+        return 0;
+    }
+
+    uint8_t prefix[PREFIX_SIZE];
+    peek(prefix, PREFIX_SIZE);
+
+    msg::standard::UInt32 length;
+    size_t offset = 0;
+    length.deserialize(prefix, PREFIX_SIZE, offset);
+    return PREFIX_SIZE + static_cast<size_t>(length.data);
+}
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,204 @@
+#include "rix/ipc/coro.hpp"
+
+#include <algorithm>
+#include <iterator>
+
+namespace rix {
+namespace ipc {
+namespace coro {
+
+namespace {
+
+thread_local Scheduler *current_scheduler = nullptr;
+
+}  // namespace
+
+Scheduler::Scheduler() : sequence_(0), stopped_(false) {}
+
+Scheduler::~Scheduler() {
+    // The frames are destroyed with the tasks; their handles must not be
+    // resumed afterwards
+    ready_.clear();
+    waiters_.clear();
+    timers_ = {};
+    tasks_.clear();
+}
+
+Scheduler *Scheduler::current() { return current_scheduler; }
+
+void Scheduler::spawn(Task<void> task) {
+    if (!task.handle_ || task.done()) {
+        return;
+    }
+    ready_.push_back(task.handle_);
+    tasks_.push_back(std::move(task));
+}
+
+void Scheduler::run() {
+    Scheduler *previous = current_scheduler;
+    current_scheduler = this;
+    stopped_ = false;
+
+    try {
+        while (!stopped_) {
+            while (!ready_.empty() && !stopped_) {
+                std::coroutine_handle<> handle = ready_.front();
+                ready_.pop_front();
+                handle.resume();
+            }
+            reap();
+
+            if (stopped_ || tasks_.empty()) {
+                break;
+            }
+            if (!ready_.empty()) {
+                continue;
+            }
+
+            // Nothing can wake a coroutine
+            if (waiters_.empty() && timers_.empty()) {
+                break;
+            }
+
+            rix::util::Duration timeout =
+                timers_.empty() ? rix::util::Duration::max() : timers_.top().deadline.remaining();
+            for (const auto &event : poller_.wait(timeout)) {
+                dispatch(event);
+            }
+
+            rix::util::Time now = rix::util::Time::monotonic_now();
+            while (!timers_.empty() && timers_.top().deadline <= now) {
+                ready_.push_back(timers_.top().handle);
+                timers_.pop();
+            }
+        }
+    } catch (...) {
+        current_scheduler = previous;
+        throw;
+    }
+
+    current_scheduler = previous;
+}
+
+void Scheduler::stop() { stopped_ = true; }
+
+size_t Scheduler::size() const { return tasks_.size(); }
+
+bool Scheduler::ok() const { return poller_.ok(); }
+
+bool Scheduler::wait_for(int fd, uint32_t events, std::coroutine_handle<> handle) {
+    if (fd < 0) {
+        return false;
+    }
+
+    auto [it, inserted] = waiters_.try_emplace(fd);
+    Waiters &waiters = it->second;
+    if (((events & Poller::READABLE) && waiters.reader) || ((events & Poller::WRITABLE) && waiters.writer)) {
+        return false;
+    }
+
+    Waiters previous = waiters;
+    if (events & Poller::READABLE) {
+        waiters.reader = handle;
+    }
+    if (events & Poller::WRITABLE) {
+        waiters.writer = handle;
+    }
+
+    uint32_t wanted = (waiters.reader ? static_cast<uint32_t>(Poller::READABLE) : 0) |
+                      (waiters.writer ? static_cast<uint32_t>(Poller::WRITABLE) : 0);
+    bool registered = inserted ? poller_.add(fd, wanted) : poller_.modify(fd, wanted);
+    if (!registered) {
+        // Regular files cannot be polled; they are always ready
+        waiters = previous;
+        if (inserted) {
+            waiters_.erase(it);
+        }
+        return false;
+    }
+    return true;
+}
+
+void Scheduler::wake_at(const rix::util::Time &deadline, std::coroutine_handle<> handle) {
+    timers_.push({deadline, sequence_++, handle});
+}
+
+void Scheduler::dispatch(const Poller::Event &event) {
+    auto it = waiters_.find(event.fd);
+    if (it == waiters_.end()) {
+        return;
+    }
+
+    // A hangup or an error wakes both waiters, whose IO then reports it
+    bool failed = event.hangup() || event.error();
+    Waiters &waiters = it->second;
+    if (waiters.reader && (event.readable() || failed)) {
+        ready_.push_back(std::exchange(waiters.reader, nullptr));
+    }
+    if (waiters.writer && (event.writable() || failed)) {
+        ready_.push_back(std::exchange(waiters.writer, nullptr));
+    }
+    update(event.fd);
+}
+
+void Scheduler::update(int fd) {
+    auto it = waiters_.find(fd);
+    if (it == waiters_.end()) {
+        return;
+    }
+
+    uint32_t wanted = (it->second.reader ? static_cast<uint32_t>(Poller::READABLE) : 0) |
+                      (it->second.writer ? static_cast<uint32_t>(Poller::WRITABLE) : 0);
+    if (wanted == 0) {
+        poller_.remove(fd);
+        waiters_.erase(it);
+    } else {
+        poller_.modify(fd, wanted);
+    }
+}
+
+void Scheduler::reap() {
+    auto done = std::stable_partition(tasks_.begin(), tasks_.end(), [](const Task<void> &task) { return !task.done(); });
+    std::vector<Task<void>> finished;
+    std::move(done, tasks_.end(), std::back_inserter(finished));
+    tasks_.erase(done, tasks_.end());
+    for (auto &task : finished) {
+        task.result();
+    }
+}
+
+bool SleepAwaiter::await_ready() const {
+    if (deadline_ <= rix::util::Time::monotonic_now()) {
+        return true;
+    }
+    if (Scheduler::current() == nullptr) {
+        rix::util::sleep_for(deadline_.remaining());
+        return true;
+    }
+    return false;
+}
+
+Task<ssize_t> async_read(const interfaces::IO &io, uint8_t *buffer, size_t size) {
+    co_await readable(io);
+    co_return io.read(buffer, size);
+}
+
+Task<ssize_t> async_write(const interfaces::IO &io, const uint8_t *buffer, size_t size) {
+    co_await writable(io);
+    co_return io.write(buffer, size);
+}
+
+Task<bool> async_wait(const interfaces::Notification &notif) {
+    while (!notif.is_ready()) {
+        if (notif.fd() < 0) {
+            co_await coro::sleep_for(rix::util::Duration(0.001));
+        } else {
+            co_await readable(notif.fd());
+        }
+    }
+    co_return true;
+}
+
+}  // namespace coro
+}  // namespace ipc
+}  // namespace rix
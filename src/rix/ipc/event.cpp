@@ -0,0 +1,59 @@
+#include "rix/ipc/event.hpp"
+
+namespace rix {
+namespace ipc {
+
+Event::Event(Mode mode, uint32_t initial) : mode_(mode), count_(0) {
+    int flags = EFD_NONBLOCK | EFD_CLOEXEC;
+    if (mode_ == Mode::SEMAPHORE) {
+        flags |= EFD_SEMAPHORE;
+    }
+
+    int fd = ::eventfd(initial, flags);
+    if (fd >= 0) {
+        file_ = File(fd);
+    }
+}
+
+bool Event::raise() const { return raise(1); }
+
+bool Event::raise(uint64_t n) const {
+    if (!file_.ok() || n == 0) {
+        return false;
+    }
+    return file_.write(reinterpret_cast<const uint8_t *>(&n), sizeof(n)) == sizeof(n);
+}
+
+bool Event::wait(const rix::util::Duration &d) const {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    // The eventfd is non-blocking, so try to consume the counter before
+    // waiting for it to become non-zero
+    uint64_t value;
+    ssize_t n = file_.read(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+    if (n != sizeof(value)) {
+        if (!file_.wait_for_readable(d)) {
+            return false;
+        }
+        n = file_.read(reinterpret_cast<uint8_t *>(&value), sizeof(value));
+    }
+
+    if (n != sizeof(value)) {
+        return false;
+    }
+    count_ = value;
+    return true;
+}
+
+uint64_t Event::count() const { return count_; }
+
+Event::Mode Event::mode() const { return mode_; }
+
+bool Event::ok() const { return file_.ok(); }
+
+int Event::fd() const { return file_.fd(); }
+
+}  // namespace ipc
+}  // namespace rix
@@ -8,8 +8,8 @@
 namespace rix {
 namespace ipc {
 
-Fifo::Fifo(const std::string &pathname, Mode mode, bool nonblocking)
-    : pathname_(pathname), mode_(mode) {
+Fifo::Fifo(const std::string &pathname, Mode mode, bool nonblocking, bool packet)
+    : pathname_(pathname), mode_(mode), dummy_fd_(-1) {
 
     // Create FIFO if it does not exist
     if (mkfifo(pathname.c_str(), 0666) < 0) {
@@ -22,6 +22,9 @@ Fifo::Fifo(const std::string &pathname, Mode mode, bool nonblocking)
     int flags = 0;
     if (mode == Mode::READ) {
         flags |= O_RDONLY;
+    } else if (mode == Mode::READ_PERSISTENT) {
+        // Opening the read end without O_NONBLOCK would wait for a writer
+        flags |= O_RDONLY | O_NONBLOCK;
     } else {
         flags |= O_WRONLY;
     }
@@ -31,16 +34,42 @@ Fifo::Fifo(const std::string &pathname, Mode mode, bool nonblocking)
     }
 
     fd_ = ::open(pathname.c_str(), flags);
+
+    if (mode == Mode::READ_PERSISTENT && fd_ >= 0) {
+        // Holding a write end open means reads never return end of file when
+        // the last external writer closes
+        dummy_fd_ = ::open(pathname.c_str(), O_WRONLY | O_NONBLOCK);
+        if (dummy_fd_ < 0) {
+            ::close(fd_);
+            fd_ = -1;
+            return;
+        }
+
+        if (!nonblocking) {
+            ::fcntl(fd_, F_SETFL, ::fcntl(fd_, F_GETFL) & ~O_NONBLOCK);
+        }
+    }
+
+    // open rejects O_DIRECT on a FIFO, but fcntl accepts it. Failure leaves
+    // the Fifo as a byte stream.
+    if (packet && mode == Mode::WRITE && fd_ >= 0) {
+        int status = ::fcntl(fd_, F_GETFL);
+        if (status >= 0) {
+            ::fcntl(fd_, F_SETFL, status | O_DIRECT);
+        }
+    }
 }
 
 Fifo::Fifo() {
     fd_ = -1;
+    dummy_fd_ = -1;
     pathname_.clear();
     mode_ = Mode::READ;
 }
 
 Fifo::Fifo(const Fifo &other) {
     fd_ = (other.fd_ >= 0) ? ::dup(other.fd_) : -1;
+    dummy_fd_ = (other.dummy_fd_ >= 0) ? ::dup(other.dummy_fd_) : -1;
     pathname_ = other.pathname_;
     mode_ = other.mode_;
 }
@@ -53,8 +82,10 @@ Fifo &Fifo::operator=(const Fifo &other) {
     if (fd_ >= 0) {
         ::close(fd_);
     }
+    close_dummy();
 
     fd_ = (other.fd_ >= 0) ? ::dup(other.fd_) : -1;
+    dummy_fd_ = (other.dummy_fd_ >= 0) ? ::dup(other.dummy_fd_) : -1;
     pathname_ = other.pathname_;
     mode_ = other.mode_;
 
@@ -64,7 +95,9 @@ Fifo &Fifo::operator=(const Fifo &other) {
 Fifo::Fifo(Fifo &&other)
     : File(std::move(other)),
       pathname_(std::move(other.pathname_)),
-      mode_(other.mode_) {
+      mode_(other.mode_),
+      dummy_fd_(other.dummy_fd_) {
+    other.dummy_fd_ = -1;
 }
 
 Fifo &Fifo::operator=(Fifo &&other) {
@@ -75,12 +108,15 @@ Fifo &Fifo::operator=(Fifo &&other) {
     if (fd_ >= 0) {
         ::close(fd_);
     }
+    close_dummy();
 
     fd_ = other.fd_;
+    dummy_fd_ = other.dummy_fd_;
     pathname_ = std::move(other.pathname_);
     mode_ = other.mode_;
 
     other.fd_ = -1;
+    other.dummy_fd_ = -1;
     other.pathname_.clear();
 
     return *this;
@@ -89,6 +125,15 @@ Fifo &Fifo::operator=(Fifo &&other) {
 Fifo::~Fifo() {
     if (fd_ >= 0) {
         ::close(fd_);
+        fd_ = -1;
+    }
+    close_dummy();
+}
+
+void Fifo::close_dummy() {
+    if (dummy_fd_ >= 0) {
+        ::close(dummy_fd_);
+        dummy_fd_ = -1;
     }
 }
 
@@ -100,5 +145,13 @@ Fifo::Mode Fifo::mode() const {
     return mode_;
 }
 
+bool Fifo::is_packet_mode() const {
+    if (fd_ < 0) {
+        return false;
+    }
+    int flags = ::fcntl(fd_, F_GETFL);
+    return flags >= 0 && (flags & O_DIRECT);
+}
+
 }  // namespace ipc
 }  // namespace rix
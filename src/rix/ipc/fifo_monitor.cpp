@@ -0,0 +1,181 @@
+#include "rix/ipc/fifo_monitor.hpp"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+bool same_file(int fd, dev_t dev, ino_t ino) {
+    struct stat st;
+    return fd >= 0 && ::fstat(fd, &st) == 0 && st.st_dev == dev && st.st_ino == ino;
+}
+
+// Lists the descriptors of this process that are open on the file
+std::vector<int> open_descriptors(dev_t dev, ino_t ino) {
+    std::vector<int> fds;
+    DIR *dir = ::opendir("/proc/self/fd");
+    if (dir == nullptr) {
+        return fds;
+    }
+    int self = ::dirfd(dir);
+    while (struct dirent *entry = ::readdir(dir)) {
+        if (entry->d_name[0] == '.') {
+            continue;
+        }
+        int fd = std::atoi(entry->d_name);
+        if (fd != self && same_file(fd, dev, ino)) {
+            fds.push_back(fd);
+        }
+    }
+    ::closedir(dir);
+    return fds;
+}
+
+// Removes the first descriptor that is no longer open on the file, which is
+// the one whose close was just reported
+bool remove_closed(std::vector<int> &fds, dev_t dev, ino_t ino) {
+    auto it = std::find_if(fds.begin(), fds.end(), [&](int fd) { return !same_file(fd, dev, ino); });
+    if (it == fds.end()) {
+        return false;
+    }
+    fds.erase(it);
+    return true;
+}
+
+}  // namespace
+
+FifoMonitor::FifoMonitor()
+    : dev_(0),
+      ino_(0),
+      event_(Event::NONE),
+      writers_(0) {}
+
+FifoMonitor::FifoMonitor(const std::string &pathname) : FifoMonitor() {
+    pathname_ = pathname;
+    struct stat st;
+    if (::stat(pathname.c_str(), &st) < 0) {
+        return;
+    }
+    dev_ = st.st_dev;
+    ino_ = st.st_ino;
+
+    int fd = ::inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+
+    File inotify(fd);
+    if (::inotify_add_watch(fd, pathname.c_str(), IN_OPEN | IN_CLOSE_WRITE | IN_CLOSE_NOWRITE) < 0) {
+        return;
+    }
+    file_ = std::move(inotify);
+
+    // Opens of these descriptors happened before the watch and are not queued
+    opened_before_ = open_descriptors(dev_, ino_);
+}
+
+bool FifoMonitor::raise() const { return false; }
+
+bool FifoMonitor::ignore(const Fifo &fifo) {
+    if (!file_.ok() || !same_file(fifo.fd(), dev_, ino_)) {
+        return false;
+    }
+
+    // Opens after the watch cannot be told apart from those of writers
+    for (int fd : {fifo.fd(), fifo.dummy_fd_}) {
+        if (fd >= 0 && std::find(opened_before_.begin(), opened_before_.end(), fd) == opened_before_.end()) {
+            return false;
+        }
+    }
+
+    for (int fd : {fifo.fd(), fifo.dummy_fd_}) {
+        if (fd < 0) {
+            continue;
+        }
+        if ((::fcntl(fd, F_GETFL) & O_ACCMODE) == O_RDONLY) {
+            ignored_readers_.push_back(fd);
+        } else {
+            ignored_writers_.push_back(fd);
+        }
+    }
+    return true;
+}
+
+int FifoMonitor::next() const {
+    // The watch is on the file itself, so events carry no name and each read
+    // returns exactly one event
+    struct inotify_event ev;
+    if (file_.read(reinterpret_cast<uint8_t *>(&ev), sizeof(ev)) != sizeof(ev)) {
+        return -1;
+    }
+
+    if (ev.mask & IN_OPEN) {
+        writers_++;
+        return static_cast<int>(Event::ATTACH);
+    }
+    if (ev.mask & IN_CLOSE_WRITE) {
+        if (remove_closed(ignored_writers_, dev_, ino_)) {
+            return static_cast<int>(Event::NONE);
+        }
+        writers_ = std::max(writers_ - 1, 0);
+        return static_cast<int>(Event::DETACH);
+    }
+    if (ev.mask & IN_CLOSE_NOWRITE) {
+        if (remove_closed(ignored_readers_, dev_, ino_)) {
+            return static_cast<int>(Event::NONE);
+        }
+        // A reader closed, which was counted as an attach when it opened
+        writers_ = std::max(writers_ - 1, 0);
+    }
+    return static_cast<int>(Event::NONE);
+}
+
+bool FifoMonitor::wait(const rix::util::Duration &d) const {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    // Events that are not reported (readers closing) are consumed without
+    // ending the wait
+    const bool forever = (d == rix::util::Duration::max());
+    const rix::util::Time deadline = forever ? rix::util::Time::max() : rix::util::Time::monotonic_now() + d;
+    while (true) {
+        int result = next();
+        if (result > 0) {
+            event_ = static_cast<Event>(result);
+            return true;
+        }
+        if (result == 0) {
+            continue;
+        }
+
+        rix::util::Duration remaining = forever ? d : deadline - rix::util::Time::monotonic_now();
+        if (remaining < rix::util::Duration(0.0)) {
+            remaining = rix::util::Duration(0.0);
+        }
+        if (!file_.wait_for_readable(remaining)) {
+            return false;
+        }
+    }
+}
+
+FifoMonitor::Event FifoMonitor::event() const { return event_; }
+
+int FifoMonitor::writers() const { return writers_; }
+
+std::string FifoMonitor::pathname() const { return pathname_; }
+
+bool FifoMonitor::ok() const { return file_.ok(); }
+
+int FifoMonitor::fd() const { return file_.fd(); }
+
+}  // namespace ipc
+}  // namespace rix
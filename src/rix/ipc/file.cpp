@@ -2,7 +2,9 @@
 
 #include <fcntl.h>
 #include <poll.h>
+#include <sys/ioctl.h>
 #include <sys/stat.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace rix {
@@ -90,6 +92,20 @@ ssize_t File::write(const uint8_t *buffer, size_t size) const {
     return ::write(fd_, buffer, size);
 }
 
+ssize_t File::readv(const struct iovec *iov, int iovcnt) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    return ::readv(fd_, iov, iovcnt);
+}
+
+ssize_t File::writev(const struct iovec *iov, int iovcnt) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    return ::writev(fd_, iov, iovcnt);
+}
+
 int File::fd() const { return fd_; }
 
 /**< TODO */
@@ -129,21 +145,38 @@ bool File::is_nonblocking() const {
     return (flags & O_NONBLOCK) != 0;
 }
 
-/**< TODO */
-bool File::wait_for_writable(const util::Duration &duration) const {
+ssize_t File::capacity() const {
     if (fd_ < 0) {
-        return false;
+        return -1;
     }
+    return ::fcntl(fd_, F_GETPIPE_SZ);
+}
 
-    struct pollfd pfd;
-    pfd.fd = fd_;
-    pfd.events = POLLOUT;
-    pfd.revents = 0;
+ssize_t File::set_capacity(size_t size) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    return ::fcntl(fd_, F_SETPIPE_SZ, static_cast<int>(size));
+}
 
-    int timeout_ms = (duration == util::Duration::max()) ? -1 : duration.to_milliseconds();
-    int ret = ::poll(&pfd, 1, timeout_ms);
+ssize_t File::bytes_queued() const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    int queued = 0;
+    if (::ioctl(fd_, FIONREAD, &queued) < 0) {
+        return -1;
+    }
+    return queued;
+}
 
-    return (ret > 0) && (pfd.revents & POLLOUT);
+/**< TODO */
+bool File::wait_for_writable(const util::Duration &duration) const {
+    if (fd_ < 0) {
+        return false;
+    }
+    return wait_strategy_.wait(fd_, POLLOUT, duration, wait_stats_,
+                               [this]() { return WaitStrategy::block(fd_, POLLOUT, util::Duration(0)); });
 }
 
 /**< TODO */
@@ -151,17 +184,17 @@ bool File::wait_for_readable(const util::Duration &duration) const {
     if (fd_ < 0) {
         return false;
     }
+    return wait_strategy_.wait(fd_, POLLIN, duration, wait_stats_,
+                               [this]() { return WaitStrategy::block(fd_, POLLIN, util::Duration(0)); });
+}
 
-    struct pollfd pfd;
-    pfd.fd = fd_;
-    pfd.events = POLLIN;
-    pfd.revents = 0;
+void File::set_wait_strategy(const WaitStrategy &strategy) { wait_strategy_ = strategy; }
 
-    int timeout_ms = (duration == util::Duration::max()) ? -1 : duration.to_milliseconds();
-    int ret = ::poll(&pfd, 1, timeout_ms);
+const WaitStrategy &File::wait_strategy() const { return wait_strategy_; }
 
-    return (ret > 0) && (pfd.revents & POLLIN);
-}
+const WaitStats &File::wait_stats() const { return wait_stats_; }
+
+void File::reset_wait_stats() { wait_stats_ = WaitStats(); }
 
 }  // namespace ipc
 }  // namespace rix
@@ -0,0 +1,128 @@
+#include "rix/ipc/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+int to_madvise(MappedFile::Advice advice) {
+    switch (advice) {
+        case MappedFile::Advice::SEQUENTIAL:
+            return MADV_SEQUENTIAL;
+        case MappedFile::Advice::RANDOM:
+            return MADV_RANDOM;
+        case MappedFile::Advice::WILLNEED:
+            return MADV_WILLNEED;
+        case MappedFile::Advice::DONTNEED:
+            return MADV_DONTNEED;
+        default:
+            return MADV_NORMAL;
+    }
+}
+
+}  // namespace
+
+MappedFile::MappedFile() : data_(nullptr), size_(0), ok_(false) {}
+
+MappedFile::MappedFile(const std::string &pathname, Advice advice) : MappedFile() {
+    File file(pathname, O_RDONLY);
+    map(file, advice);
+}
+
+MappedFile::MappedFile(const File &file, Advice advice) : MappedFile() { map(file, advice); }
+
+MappedFile::MappedFile(MappedFile &&src) : data_(src.data_), size_(src.size_), ok_(src.ok_) {
+    src.data_ = nullptr;
+    src.size_ = 0;
+    src.ok_ = false;
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&src) {
+    if (this == &src) {
+        return *this;
+    }
+
+    unmap();
+    data_ = src.data_;
+    size_ = src.size_;
+    ok_ = src.ok_;
+    src.data_ = nullptr;
+    src.size_ = 0;
+    src.ok_ = false;
+    return *this;
+}
+
+MappedFile::~MappedFile() { unmap(); }
+
+void MappedFile::map(const File &file, Advice advice) {
+    struct stat st;
+    if (!file.ok() || ::fstat(file.fd(), &st) < 0 || !S_ISREG(st.st_mode)) {
+        return;
+    }
+
+    // mmap rejects a length of 0, but an empty file is still a valid view
+    size_ = st.st_size;
+    if (size_ == 0) {
+        ok_ = true;
+        return;
+    }
+
+    void *addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, file.fd(), 0);
+    if (addr == MAP_FAILED) {
+        size_ = 0;
+        return;
+    }
+
+    data_ = static_cast<uint8_t *>(addr);
+    ok_ = true;
+    if (advice != Advice::NORMAL) {
+        this->advise(advice);
+    }
+}
+
+void MappedFile::unmap() {
+    if (data_) {
+        ::munmap(data_, size_);
+    }
+    data_ = nullptr;
+    size_ = 0;
+    ok_ = false;
+}
+
+const uint8_t *MappedFile::data() const { return data_; }
+
+size_t MappedFile::size() const { return size_; }
+
+std::span<const uint8_t> MappedFile::span() const { return {data_, size_}; }
+
+std::span<const uint8_t> MappedFile::span(size_t offset, size_t length) const {
+    if (offset >= size_) {
+        return {};
+    }
+    return {data_ + offset, std::min(length, size_ - offset)};
+}
+
+bool MappedFile::advise(Advice advice, size_t offset, size_t length) const {
+    if (!data_ || offset >= size_) {
+        return false;
+    }
+
+    // madvise needs a page aligned start, so the range is widened to the page
+    // containing offset
+    size_t page = ::sysconf(_SC_PAGESIZE);
+    size_t start = offset - offset % page;
+    size_t end = (length == 0) ? size_ : std::min(size_, offset + length);
+    return ::madvise(data_ + start, end - start, to_madvise(advice)) == 0;
+}
+
+bool MappedFile::ok() const { return ok_; }
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,65 @@
+#include "rix/ipc/packet.hpp"
+
+#include <sys/uio.h>
+
+#include <cerrno>
+
+#include "rix/msg/standard/UInt32.hpp"
+
+namespace rix {
+namespace ipc {
+
+PacketWriter::PacketWriter(const interfaces::IO &io) : io_(io) {}
+
+ssize_t PacketWriter::write_frame(const uint8_t *payload, size_t size) const {
+    if (size > MAX_FRAME_SIZE - PREFIX_SIZE) {
+        errno = EMSGSIZE;
+        return -1;
+    }
+
+    rix::msg::standard::UInt32 length;
+    length.data = size;
+    uint8_t prefix[PREFIX_SIZE];
+    size_t offset = 0;
+    length.serialize(prefix, offset);
+
+    struct iovec iov[2];
+    iov[0].iov_base = prefix;
+    iov[0].iov_len = PREFIX_SIZE;
+    iov[1].iov_base = const_cast<uint8_t *>(payload);
+    iov[1].iov_len = size;
+    return io_.writev(iov, 2);
+}
+
+PacketReader::PacketReader(const interfaces::IO &io) : io_(io) {}
+
+ssize_t PacketReader::read_frame(std::vector<uint8_t> &frame) const {
+    uint8_t prefix[PacketWriter::PREFIX_SIZE];
+    frame.resize(PacketWriter::MAX_FRAME_SIZE - PacketWriter::PREFIX_SIZE);
+
+    struct iovec iov[2];
+    iov[0].iov_base = prefix;
+    iov[0].iov_len = PacketWriter::PREFIX_SIZE;
+    iov[1].iov_base = frame.data();
+    iov[1].iov_len = frame.size();
+    ssize_t n = io_.readv(iov, 2);
+    if (n <= 0) {
+        frame.clear();
+        return n;
+    }
+
+    rix::msg::standard::UInt32 length;
+    size_t offset = 0;
+    if (static_cast<size_t>(n) < PacketWriter::PREFIX_SIZE || !length.deserialize(prefix, sizeof(prefix), offset) ||
+        length.data != n - PacketWriter::PREFIX_SIZE) {
+        frame.clear();
+        errno = EBADMSG;
+        return -1;
+    }
+
+    frame.resize(length.data);
+    return n;
+}
+
+}  // namespace ipc
+}  // namespace rix
@@ -1,14 +1,15 @@
 #include "rix/ipc/pipe.hpp"
 
+#include <fcntl.h>
 #include <unistd.h>
 
 namespace rix {
 namespace ipc {
 
 /**< TODO */
-std::array<Pipe, 2> Pipe::create() {
+std::array<Pipe, 2> Pipe::create(bool packet) {
     int fds[2];
-    if (::pipe(fds) < 0) {
+    if (::pipe2(fds, packet ? O_DIRECT : 0) < 0) {
         return {};
     }
 
@@ -89,6 +90,14 @@ bool Pipe::is_write_end() const {
     return !read_end_;
 }
 
+bool Pipe::is_packet_mode() const {
+    if (fd_ < 0) {
+        return false;
+    }
+    int flags = ::fcntl(fd_, F_GETFL);
+    return flags >= 0 && (flags & O_DIRECT);
+}
+
 Pipe::Pipe(int fd, bool read_end)
     : File(fd), read_end_(read_end) {}
 
@@ -0,0 +1,137 @@
+#include "rix/ipc/poller.hpp"
+
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <utility>
+
+namespace rix {
+namespace ipc {
+
+Poller::Poller() : epfd_(::epoll_create1(EPOLL_CLOEXEC)), size_(0) {}
+
+Poller::~Poller() {
+    if (epfd_ >= 0) {
+        ::close(epfd_);
+        epfd_ = -1;
+    }
+}
+
+Poller::Poller(Poller &&other)
+    : epfd_(-1), size_(0), events_(std::move(other.events_)), ready_(std::move(other.ready_)) {
+    std::swap(epfd_, other.epfd_);
+    std::swap(size_, other.size_);
+}
+
+Poller &Poller::operator=(Poller &&other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    if (epfd_ >= 0) {
+        ::close(epfd_);
+        epfd_ = -1;
+    }
+    size_ = 0;
+
+    std::swap(epfd_, other.epfd_);
+    std::swap(size_, other.size_);
+    events_ = std::move(other.events_);
+    ready_ = std::move(other.ready_);
+    return *this;
+}
+
+bool Poller::add(const interfaces::IO &io, uint32_t events, Trigger trigger) {
+    return add(io.fd(), events, trigger);
+}
+
+bool Poller::add(const interfaces::Notification &notif, Trigger trigger) {
+    return add(notif.fd(), READABLE, trigger);
+}
+
+bool Poller::add(int fd, uint32_t events, Trigger trigger) {
+    if (epfd_ < 0 || fd < 0) {
+        return false;
+    }
+
+    struct epoll_event ev = {};
+    ev.events = events | (trigger == Trigger::EDGE ? static_cast<uint32_t>(EPOLLET) : 0);
+    ev.data.fd = fd;
+    if (::epoll_ctl(epfd_, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        return false;
+    }
+    size_++;
+    return true;
+}
+
+bool Poller::modify(int fd, uint32_t events, Trigger trigger) {
+    if (epfd_ < 0 || fd < 0) {
+        return false;
+    }
+
+    struct epoll_event ev = {};
+    ev.events = events | (trigger == Trigger::EDGE ? static_cast<uint32_t>(EPOLLET) : 0);
+    ev.data.fd = fd;
+    return ::epoll_ctl(epfd_, EPOLL_CTL_MOD, fd, &ev) == 0;
+}
+
+bool Poller::remove(const interfaces::IO &io) { return remove(io.fd()); }
+
+bool Poller::remove(const interfaces::Notification &notif) { return remove(notif.fd()); }
+
+bool Poller::remove(int fd) {
+    if (epfd_ < 0 || fd < 0) {
+        return false;
+    }
+
+    if (::epoll_ctl(epfd_, EPOLL_CTL_DEL, fd, nullptr) < 0) {
+        return false;
+    }
+    size_--;
+    return true;
+}
+
+const std::vector<Poller::Event> &Poller::wait(const util::Duration &duration) {
+    ready_.clear();
+    if (epfd_ < 0) {
+        return ready_;
+    }
+
+    events_.resize(size_ > 0 ? size_ : 1);
+
+    const bool forever = (duration == util::Duration::max());
+    const auto deadline = std::chrono::steady_clock::now() + (forever ? std::chrono::nanoseconds(0) : duration.get());
+    util::Duration remaining = duration;
+
+    int n;
+    while (true) {
+        int timeout_ms = forever ? -1 : remaining.to_milliseconds(util::Time::RoundType::CEIL);
+        n = ::epoll_wait(epfd_, events_.data(), events_.size(), timeout_ms);
+        if (n >= 0 || errno != EINTR) {
+            break;
+        }
+        if (!forever) {
+            remaining = util::Duration(deadline - std::chrono::steady_clock::now());
+            if (remaining < util::Duration(0.0)) {
+                remaining = util::Duration(0.0);
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        ready_.push_back({events_[i].data.fd, events_[i].events});
+    }
+    return ready_;
+}
+
+size_t Poller::size() const { return size_; }
+
+int Poller::fd() const { return epfd_; }
+
+bool Poller::ok() const { return epfd_ >= 0; }
+
+const std::vector<Poller::Event> &Poller::wait_until(const util::Time &deadline) { return wait(deadline.remaining()); }
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,67 @@
+#include "rix/ipc/queue_sampler.hpp"
+
+#include <algorithm>
+
+namespace rix {
+namespace ipc {
+
+QueueSampler::QueueSampler(const File &file, const rix::util::Duration &period, size_t threshold)
+    : file_(file), threshold_(threshold), last_(0), high_water_mark_(0), samples_(0) {
+    if (!timer_.start(period, period)) {
+        // Moving the timer out leaves the sampler in an invalid state
+        TimerFd discard(std::move(timer_));
+    }
+}
+
+bool QueueSampler::raise() const { return timer_.raise(); }
+
+void QueueSampler::sample() const {
+    ssize_t queued = file_.bytes_queued();
+    last_ = (queued > 0) ? queued : 0;
+    high_water_mark_ = std::max(high_water_mark_, last_);
+    samples_++;
+}
+
+bool QueueSampler::wait(const rix::util::Duration &d) const {
+    if (!timer_.ok()) {
+        return false;
+    }
+
+    // Samples below the threshold are consumed without ending the wait
+    const bool forever = (d == rix::util::Duration::max());
+    const rix::util::Duration deadline = forever ? d : TimerFd::now() + d;
+    while (true) {
+        rix::util::Duration remaining = forever ? d : deadline - TimerFd::now();
+        if (remaining < rix::util::Duration(0.0)) {
+            remaining = rix::util::Duration(0.0);
+        }
+        if (!timer_.wait(remaining)) {
+            return false;
+        }
+
+        sample();
+        if (last_ >= threshold_) {
+            return true;
+        }
+    }
+}
+
+size_t QueueSampler::last() const { return last_; }
+
+size_t QueueSampler::high_water_mark() const { return high_water_mark_; }
+
+uint64_t QueueSampler::samples() const { return samples_; }
+
+size_t QueueSampler::threshold() const { return threshold_; }
+
+void QueueSampler::reset() {
+    high_water_mark_ = 0;
+    samples_ = 0;
+}
+
+bool QueueSampler::ok() const { return timer_.ok(); }
+
+int QueueSampler::fd() const { return timer_.fd(); }
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,117 @@
+#include "rix/ipc/relay.hpp"
+
+#include <cerrno>
+
+namespace rix {
+namespace ipc {
+
+ssize_t Relay::splice(const File &in, const File &out, size_t size, unsigned int flags) {
+    if (!in.ok() || !out.ok()) {
+        return -1;
+    }
+    return ::splice(in.fd(), nullptr, out.fd(), nullptr, size, flags);
+}
+
+ssize_t Relay::tee(const File &in, const File &out, size_t size, unsigned int flags) {
+    if (!in.ok() || !out.ok()) {
+        return -1;
+    }
+    return ::tee(in.fd(), out.fd(), size, flags);
+}
+
+ssize_t Relay::vmsplice(const File &out, const struct iovec *iov, int iovcnt, unsigned int flags) {
+    if (!out.ok()) {
+        return -1;
+    }
+    return ::vmsplice(out.fd(), iov, iovcnt, flags);
+}
+
+Relay::Relay() : input_(nullptr), output_(nullptr), recording_(nullptr), pending_(0), dropped_(0) {}
+
+Relay::Relay(const File &input, const File &output)
+    : input_(&input), output_(&output), recording_(nullptr), live_(Pipe::create()), pending_(0), dropped_(0) {}
+
+Relay::Relay(const File &input, const File &output, const File &recording, size_t record_capacity)
+    : input_(&input),
+      output_(&output),
+      recording_(&recording),
+      live_(Pipe::create()),
+      mirror_(Pipe::create()),
+      pending_(0),
+      dropped_(0) {
+    // A larger recording pipe absorbs longer stalls of the recording before
+    // data is dropped. Failing to resize it is not an error.
+    mirror_[1].set_capacity(record_capacity);
+}
+
+ssize_t Relay::forward(size_t max) {
+    if (!ok()) {
+        return -1;
+    }
+
+    // Bytes left over from a failed output must go out before new input, and
+    // were already mirrored
+    if (!flush()) {
+        return -1;
+    }
+
+    ssize_t n = splice(*input_, live_[1], max);
+    if (n <= 0) {
+        if (n == 0) {
+            finish();
+        }
+        return n;
+    }
+    pending_ = n;
+
+    // Never block on the recording. A chunk that does not fit is dropped
+    // whole rather than cut, so the recording does not lose its framing.
+    if (mirror_[1].ok()) {
+        ssize_t capacity = mirror_[1].capacity();
+        ssize_t queued = mirror_[1].bytes_queued();
+        ssize_t mirrored = -1;
+        if (capacity < 0 || queued < 0 || capacity - queued >= n) {
+            mirrored = tee(live_[0], mirror_[1], n, SPLICE_F_NONBLOCK);
+        }
+        dropped_ += (mirrored > 0) ? n - mirrored : n;
+    }
+
+    return flush() ? n : -1;
+}
+
+ssize_t Relay::record(size_t max) const {
+    if (!recording_ || !mirror_[0].ok()) {
+        return -1;
+    }
+    return splice(mirror_[0], *recording_, max);
+}
+
+void Relay::finish() { mirror_[1] = Pipe(); }
+
+size_t Relay::dropped() const { return dropped_; }
+
+bool Relay::is_recording() const { return recording_ != nullptr; }
+
+bool Relay::ok() const {
+    if (!input_ || !output_ || !input_->ok() || !output_->ok() || !live_[0].ok() || !live_[1].ok()) {
+        return false;
+    }
+    return !recording_ || (recording_->ok() && mirror_[0].ok());
+}
+
+bool Relay::flush() {
+    while (pending_ > 0) {
+        ssize_t n = splice(live_[0], *output_, pending_);
+        if (n <= 0) {
+            if (n == 0) {
+                errno = EPIPE;
+            }
+            return false;
+        }
+        pending_ -= n;
+    }
+    return true;
+}
+
+}  // namespace ipc
+}  // namespace rix
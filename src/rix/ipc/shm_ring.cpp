@@ -0,0 +1,373 @@
+#include "rix/ipc/shm_ring.hpp"
+
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstring>
+#include <thread>
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+constexpr uint32_t RING_MAGIC = 0x52494e47;  // "RING"
+
+long futex_wait(std::atomic<uint32_t> &word, uint32_t expected, const struct timespec *timeout) {
+    return ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+}
+
+long futex_wake(std::atomic<uint32_t> &word) {
+    return ::syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief Wakes the peer if, and only if, it is parked on `seq`. The fence
+ * orders the preceding publication against the load of `parked`, pairing with
+ * the fence in `park`.
+ */
+void wake(std::atomic<uint32_t> &parked, std::atomic<uint32_t> &seq) {
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (parked.load(std::memory_order_relaxed) > 0) {
+        seq.fetch_add(1, std::memory_order_release);
+        futex_wake(seq);
+    }
+}
+
+/**
+ * @brief Blocks on the futex word `seq` until `ready` returns true or the
+ * duration elapses.
+ */
+template <typename Pred>
+bool park(Pred ready, std::atomic<uint32_t> &parked, std::atomic<uint32_t> &seq, const util::Duration &duration) {
+    if (ready()) {
+        return true;
+    }
+
+    const bool forever = (duration == util::Duration::max());
+    const auto deadline = std::chrono::steady_clock::now() + (forever ? std::chrono::nanoseconds(0) : duration.get());
+
+    while (true) {
+        const uint32_t expected = seq.load(std::memory_order_acquire);
+        parked.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (ready()) {
+            parked.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        struct timespec ts;
+        struct timespec *timeout = nullptr;
+        if (!forever) {
+            auto remaining = deadline - std::chrono::steady_clock::now();
+            if (remaining <= std::chrono::nanoseconds(0)) {
+                parked.fetch_sub(1, std::memory_order_relaxed);
+                return false;
+            }
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+            ts.tv_sec = ns / 1000000000;
+            ts.tv_nsec = ns % 1000000000;
+            timeout = &ts;
+        }
+
+        futex_wait(seq, expected, timeout);
+        parked.fetch_sub(1, std::memory_order_relaxed);
+        if (ready()) {
+            return true;
+        }
+    }
+}
+
+constexpr size_t align_up(size_t value, size_t alignment) { return (value + alignment - 1) & ~(alignment - 1); }
+
+}  // namespace
+
+bool ShmRing::remove(const std::string &name) {
+    std::string shm_name = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    return ::shm_unlink(shm_name.c_str()) == 0;
+}
+
+ShmRing::ShmRing() : header_(nullptr), data_(nullptr), mode_(Mode::READ), nonblocking_(false) {}
+
+ShmRing::ShmRing(const std::string &name, Mode mode, size_t capacity, bool nonblocking)
+    : header_(nullptr), data_(nullptr), mode_(mode), nonblocking_(nonblocking) {
+    name_ = (!name.empty() && name[0] == '/') ? name : "/" + name;
+    const size_t header_size = align_up(sizeof(Header), 64);
+
+    // Exactly one side creates and initializes the ring
+    bool creator = true;
+    int fd = ::shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0666);
+    if (fd < 0) {
+        if (errno != EEXIST) {
+            return;
+        }
+        creator = false;
+        fd = ::shm_open(name_.c_str(), O_RDWR, 0);
+        if (fd < 0) {
+            return;
+        }
+    }
+
+    size_t total = 0;
+    if (creator) {
+        if (capacity == 0 || capacity > UINT32_MAX) {
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            return;
+        }
+        total = header_size + capacity;
+        if (::ftruncate(fd, total) < 0) {
+            ::close(fd);
+            ::shm_unlink(name_.c_str());
+            return;
+        }
+    } else {
+        // Wait for the creator to size the object
+        struct stat st;
+        for (int i = 0; i < 1000; i++) {
+            if (::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) > header_size) {
+                total = st.st_size;
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (total == 0) {
+            ::close(fd);
+            return;
+        }
+    }
+
+    void *ptr = ::mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (ptr == MAP_FAILED) {
+        if (creator) ::shm_unlink(name_.c_str());
+        return;
+    }
+
+    Header *header = static_cast<Header *>(ptr);
+    if (creator) {
+        // The object is zero-filled by ftruncate, which is a valid initial
+        // state for every atomic field
+        header->capacity = capacity;
+        header->magic.store(RING_MAGIC, std::memory_order_release);
+    } else {
+        bool ready = false;
+        for (int i = 0; i < 1000 && !ready; i++) {
+            ready = header->magic.load(std::memory_order_acquire) == RING_MAGIC;
+            if (!ready) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        if (!ready || header_size + header->capacity > total) {
+            ::munmap(ptr, total);
+            return;
+        }
+    }
+
+    header_ = header;
+    data_ = static_cast<uint8_t *>(ptr) + header_size;
+    if (mode_ == Mode::WRITE) {
+        header_->writer_closed.store(0, std::memory_order_release);
+    } else {
+        header_->reader_closed.store(0, std::memory_order_release);
+    }
+}
+
+ShmRing::ShmRing(ShmRing &&other)
+    : header_(nullptr), data_(nullptr), mode_(other.mode_), nonblocking_(other.nonblocking_) {
+    std::swap(header_, other.header_);
+    std::swap(data_, other.data_);
+    std::swap(name_, other.name_);
+}
+
+ShmRing &ShmRing::operator=(ShmRing &&other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    close();
+    std::swap(header_, other.header_);
+    std::swap(data_, other.data_);
+    std::swap(name_, other.name_);
+    mode_ = other.mode_;
+    nonblocking_ = other.nonblocking_;
+    return *this;
+}
+
+ShmRing::~ShmRing() { close(); }
+
+void ShmRing::close() {
+    if (!header_) {
+        return;
+    }
+
+    if (mode_ == Mode::WRITE) {
+        header_->writer_closed.store(1, std::memory_order_release);
+        wake(header_->reader_parked, header_->data_seq);
+    } else {
+        header_->reader_closed.store(1, std::memory_order_release);
+        wake(header_->writer_parked, header_->space_seq);
+    }
+
+    ::munmap(header_, map_size());
+    header_ = nullptr;
+    data_ = nullptr;
+    name_.clear();
+}
+
+ssize_t ShmRing::read(uint8_t *dst, size_t size) const {
+    struct iovec iov;
+    iov.iov_base = dst;
+    iov.iov_len = size;
+    return readv(&iov, 1);
+}
+
+ssize_t ShmRing::write(const uint8_t *src, size_t size) const {
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t *>(src);
+    iov.iov_len = size;
+    return writev(&iov, 1);
+}
+
+ssize_t ShmRing::readv(const struct iovec *iov, int iovcnt) const {
+    if (!header_ || mode_ != Mode::READ) {
+        return -1;
+    }
+
+    const size_t cap = header_->capacity;
+    while (true) {
+        const uint64_t tail = header_->tail.load(std::memory_order_relaxed);
+        const uint64_t head = header_->head.load(std::memory_order_acquire);
+        if (head != tail) {
+            // Copy the available bytes into each destination buffer in order
+            uint64_t pos = tail;
+            for (int i = 0; i < iovcnt && pos != head; i++) {
+                uint8_t *dst = static_cast<uint8_t *>(iov[i].iov_base);
+                size_t len = std::min<uint64_t>(iov[i].iov_len, head - pos);
+                const size_t index = pos % cap;
+                const size_t first = std::min(len, cap - index);
+                std::memcpy(dst, data_ + index, first);
+                std::memcpy(dst + first, data_, len - first);
+                pos += len;
+            }
+            header_->tail.store(pos, std::memory_order_release);
+            wake(header_->writer_parked, header_->space_seq);
+            return pos - tail;
+        }
+
+        if (header_->writer_closed.load(std::memory_order_acquire)) {
+            // Data published before the close must still be delivered
+            if (header_->head.load(std::memory_order_acquire) != tail) continue;
+            return 0;
+        }
+
+        if (nonblocking_) {
+            errno = EAGAIN;
+            return -1;
+        }
+        wait_for_readable(util::Duration::max());
+    }
+}
+
+ssize_t ShmRing::writev(const struct iovec *iov, int iovcnt) const {
+    if (!header_ || mode_ != Mode::WRITE) {
+        return -1;
+    }
+
+    const size_t cap = header_->capacity;
+    size_t written = 0;
+    int i = 0;
+    size_t consumed = 0; /**< Bytes of iov[i] already written */
+    while (i < iovcnt) {
+        if (header_->reader_closed.load(std::memory_order_acquire)) {
+            errno = EPIPE;
+            return -1;
+        }
+
+        const uint64_t head = header_->head.load(std::memory_order_relaxed);
+        const uint64_t tail = header_->tail.load(std::memory_order_acquire);
+        size_t space = cap - (head - tail);
+        if (space == 0) {
+            if (nonblocking_) {
+                if (written > 0) break;
+                errno = EAGAIN;
+                return -1;
+            }
+            wait_for_writable(util::Duration::max());
+            continue;
+        }
+
+        // Copy as much of the remaining source buffers as fits
+        uint64_t pos = head;
+        while (i < iovcnt && space > 0) {
+            const uint8_t *src = static_cast<const uint8_t *>(iov[i].iov_base) + consumed;
+            const size_t len = std::min(iov[i].iov_len - consumed, space);
+            const size_t index = pos % cap;
+            const size_t first = std::min(len, cap - index);
+            std::memcpy(data_ + index, src, first);
+            std::memcpy(data_, src + first, len - first);
+            pos += len;
+            space -= len;
+            consumed += len;
+            if (consumed == iov[i].iov_len) {
+                i++;
+                consumed = 0;
+            }
+        }
+        header_->head.store(pos, std::memory_order_release);
+        wake(header_->reader_parked, header_->data_seq);
+        written += pos - head;
+    }
+    return written;
+}
+
+bool ShmRing::wait_for_readable(const util::Duration &duration) const {
+    if (!header_) {
+        return false;
+    }
+
+    Header *header = header_;
+    auto ready = [header]() -> bool {
+        return header->head.load(std::memory_order_acquire) != header->tail.load(std::memory_order_acquire) ||
+               header->writer_closed.load(std::memory_order_acquire);
+    };
+    return park(ready, header->reader_parked, header->data_seq, duration);
+}
+
+bool ShmRing::wait_for_writable(const util::Duration &duration) const {
+    if (!header_) {
+        return false;
+    }
+
+    Header *header = header_;
+    auto ready = [header]() -> bool {
+        return header->head.load(std::memory_order_acquire) - header->tail.load(std::memory_order_acquire) <
+                   header->capacity ||
+               header->reader_closed.load(std::memory_order_acquire);
+    };
+    return park(ready, header->writer_parked, header->space_seq, duration);
+}
+
+void ShmRing::set_nonblocking(bool status) { nonblocking_ = status; }
+
+bool ShmRing::is_nonblocking() const { return nonblocking_; }
+
+bool ShmRing::ok() const { return header_ != nullptr; }
+
+std::string ShmRing::name() const { return name_; }
+
+ShmRing::Mode ShmRing::mode() const { return mode_; }
+
+size_t ShmRing::capacity() const { return header_ ? header_->capacity : 0; }
+
+size_t ShmRing::map_size() const { return align_up(sizeof(Header), 64) + header_->capacity; }
+
+}  // namespace ipc
+}  // namespace rix
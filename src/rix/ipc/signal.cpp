@@ -5,37 +5,99 @@
 namespace rix {
 namespace ipc {
 
-std::array<Signal::SignalNotifier, 32> Signal::notifier = {};
+std::array<Signal::SignalNotifier, 64> Signal::notifier = {};
 
-/**< TODO */
-Signal::Signal(int signum) : signum_(signum - 1) {
-    if (signum < 1 || signum > 32) {
-        throw std::invalid_argument("Signal number must be between 1 and 32");
+Signal::InfoQueue::InfoQueue() : head_(0), tail_(0) { clear(); }
+
+void Signal::InfoQueue::clear() {
+    for (size_t i = 0; i < cells_.size(); i++) {
+        cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    head_.store(0, std::memory_order_relaxed);
+    tail_.store(0, std::memory_order_relaxed);
+}
+
+bool Signal::InfoQueue::push(const Info &info) {
+    size_t pos = head_.load(std::memory_order_relaxed);
+    while (true) {
+        Cell &cell = cells_[pos & MASK];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+        if (diff == 0) {
+            // The cell is free, claim it
+            if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                cell.info = info;
+                cell.sequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The cell has not been consumed yet, the queue is full
+            return false;
+        } else {
+            pos = head_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Signal::InfoQueue::pop(Info &info) {
+    size_t pos = tail_.load(std::memory_order_relaxed);
+    while (true) {
+        Cell &cell = cells_[pos & MASK];
+        size_t seq = cell.sequence.load(std::memory_order_acquire);
+        intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+        if (diff == 0) {
+            if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                info = cell.info;
+                cell.sequence.store(pos + MASK + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (diff < 0) {
+            // The cell has not been filled yet, the queue is empty
+            return false;
+        } else {
+            pos = tail_.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+bool Signal::is_valid(int signum) { return (signum >= 1 && signum <= 32) || (signum >= SIGRTMIN && signum <= SIGRTMAX); }
+
+Signal::Signal(int signum) : signum_(signum - 1), info_{}, wait_strategy_(), wait_stats_() {
+    if (!is_valid(signum) || signum_ >= static_cast<int>(notifier.size())) {
+        signum_ = -1;
+        throw std::invalid_argument("Signal number must be between 1 and 32 or between SIGRTMIN and SIGRTMAX");
     }
 
     if (notifier[signum_].is_init) {
+        signum_ = -1;
         throw std::invalid_argument("Signal already registered");
     }
 
     notifier[signum_].pipe = Pipe::create();
-    notifier[signum_].is_init = true;
+    // No handler runs for this signal until is_init is set, so the queue left
+    // by a previous Signal can be emptied here
+    notifier[signum_].queue.clear();
+    notifier[signum_].pending.store(0, std::memory_order_relaxed);
+    notifier[signum_].dropped.store(0, std::memory_order_relaxed);
+    notifier[signum_].is_init.store(true, std::memory_order_release);
 
     // IMPORTANT: read end must be non-blocking
     notifier[signum_].pipe[0].set_nonblocking(true);
 
-    ::signal(signum, Signal::handler);
-}
+    // The handler must never block on a full pipe
+    notifier[signum_].pipe[1].set_nonblocking(true);
 
-/**< TODO */
-Signal::~Signal() {
-    if (signum_ >= 0 && signum_ < 32 && notifier[signum_].is_init) {
-        notifier[signum_].is_init = false;
-        notifier[signum_].pipe = {};
-        ::signal(signum_ + 1, SIG_DFL);
-    }
+    struct sigaction action = {};
+    action.sa_sigaction = Signal::handler;
+    action.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&action.sa_mask);
+    ::sigaction(signum, &action, nullptr);
 }
 
-Signal::Signal(Signal &&other) : signum_(-1) {
+Signal::~Signal() { reset(); }
+
+Signal::Signal(Signal &&other)
+    : signum_(-1), info_(other.info_), wait_strategy_(other.wait_strategy_), wait_stats_(other.wait_stats_) {
     std::swap(signum_, other.signum_);
 }
 
@@ -44,40 +106,64 @@ Signal &Signal::operator=(Signal &&other) {
         return *this;
     }
 
-    if (signum_ >= 0 && signum_ < 32 && notifier[signum_].is_init) {
-        notifier[signum_].is_init = false;
-        notifier[signum_].pipe = {};
-        ::signal(signum_ + 1, SIG_DFL);
-    }
+    reset();
 
     signum_ = -1;
     std::swap(signum_, other.signum_);
+    info_ = other.info_;
+    wait_strategy_ = other.wait_strategy_;
+    wait_stats_ = other.wait_stats_;
     return *this;
 }
 
-/**< TODO */
+void Signal::reset() {
+    if (signum_ >= 0 && signum_ < static_cast<int>(notifier.size()) && notifier[signum_].is_init) {
+        ::signal(signum_ + 1, SIG_DFL);
+        notifier[signum_].is_init.store(false, std::memory_order_release);
+        notifier[signum_].pipe = {};
+    }
+}
+
 bool Signal::raise() const {
-    if (signum_ < 0 || signum_ >= 32) {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size())) {
         return false;
     }
     return (::raise(signum_ + 1) == 0);
 }
 
-/**< TODO */
 bool Signal::kill(pid_t pid) const {
-    if (signum_ < 0 || signum_ >= 32) {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size())) {
         return false;
     }
     return (::kill(pid, signum_ + 1) == 0);
 }
 
+bool Signal::queue(pid_t pid, union sigval value) const {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size())) {
+        return false;
+    }
+    return (::sigqueue(pid, signum_ + 1, value) == 0);
+}
+
+bool Signal::queue(pid_t pid, int value) const {
+    union sigval sv;
+    sv.sival_int = value;
+    return queue(pid, sv);
+}
+
 int Signal::signum() const {
-    return (signum_ >= 0 && signum_ < 32) ? signum_ + 1 : -1;
+    return (signum_ >= 0 && signum_ < static_cast<int>(notifier.size())) ? signum_ + 1 : -1;
+}
+
+int Signal::fd() const {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size()) || !notifier[signum_].is_init) {
+        return -1;
+    }
+    return notifier[signum_].pipe[0].fd();
 }
 
-/**< TODO */
 bool Signal::wait(const rix::util::Duration &d) const {
-    if (signum_ < 0 || signum_ >= 32) {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size())) {
         return false;
     }
 
@@ -85,31 +171,100 @@ bool Signal::wait(const rix::util::Duration &d) const {
         return false;
     }
 
-    // First, wait until readable
-    if (!notifier[signum_].pipe[0].wait_for_readable(d)) {
+    // First, wait until readable. The handler increments the pending counter
+    // before writing the byte, so a spin that sees the counter also checks the
+    // pipe.
+    const SignalNotifier &n = notifier[signum_];
+    bool readable = wait_strategy_.wait(n.pipe[0].fd(), POLLIN, d, wait_stats_, [&n]() {
+        return n.pending.load(std::memory_order_acquire) > 0 &&
+               WaitStrategy::block(n.pipe[0].fd(), POLLIN, rix::util::Duration(0));
+    });
+    if (!readable) {
         return false;
     }
 
     // Now actually read a byte to confirm signal delivery
     uint8_t byte;
-    ssize_t n = notifier[signum_].pipe[0].read(&byte, 1);
+    if (n.pipe[0].read(&byte, 1) <= 0) {
+        return false;
+    }
+
+    // The handler pushes the delivery before writing the byte, so the queue
+    // holds one entry per byte in the pipe. The pop only fails while a handler
+    // on another thread is between claiming and filling the oldest cell.
+    while (!notifier[signum_].queue.pop(info_)) {
+    }
+    notifier[signum_].pending.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool Signal::is_ready() const {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size())) {
+        return false;
+    }
+
+    // Only touch the pipe if the handler has recorded a signal
+    if (notifier[signum_].pending.load(std::memory_order_acquire) == 0) {
+        return false;
+    }
+    return wait(rix::util::Duration(0));
+}
+
+const Signal::Info &Signal::info() const { return info_; }
+
+void Signal::set_wait_strategy(const WaitStrategy &strategy) { wait_strategy_ = strategy; }
+
+const WaitStrategy &Signal::wait_strategy() const { return wait_strategy_; }
+
+const WaitStats &Signal::wait_stats() const { return wait_stats_; }
+
+void Signal::reset_wait_stats() { wait_stats_ = WaitStats(); }
 
-    return (n > 0);
+size_t Signal::dropped() const {
+    if (signum_ < 0 || signum_ >= static_cast<int>(notifier.size()) || !notifier[signum_].is_init) {
+        return 0;
+    }
+    return notifier[signum_].dropped.load(std::memory_order_relaxed);
 }
 
-/**< TODO */
-void Signal::handler(int signum) {
+void Signal::handler(int signum, siginfo_t *info, void *) {
     int index = signum - 1;
-    if (index < 0 || index >= 32) {
+    if (index < 0 || index >= static_cast<int>(notifier.size())) {
         return;
     }
 
-    if (!notifier[index].is_init) {
+    if (!notifier[index].is_init.load(std::memory_order_acquire)) {
         return;
     }
 
+    Info delivery = {};
+    delivery.signum = signum;
+    if (info) {
+        delivery.value = info->si_value;
+        delivery.code = info->si_code;
+        delivery.pid = info->si_pid;
+        delivery.uid = info->si_uid;
+    }
+
+    // A full queue drops the delivery rather than writing a byte that could
+    // not be matched with its information
+    if (!notifier[index].queue.push(delivery)) {
+        notifier[index].dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    // The counter is incremented before the byte is written so that it never
+    // drops below the number of bytes in the pipe. The pipe capacity exceeds
+    // the queue capacity, so the write only fails if the pipe is closed. The
+    // queue must then give back an entry to stay matched with the pipe.
+    notifier[index].pending.fetch_add(1, std::memory_order_release);
     uint8_t byte = 1;
-    notifier[index].pipe[1].write(&byte, 1);
+    if (notifier[index].pipe[1].write(&byte, 1) != 1) {
+        Info discarded;
+        notifier[index].queue.pop(discarded);
+        notifier[index].pending.fetch_sub(1, std::memory_order_relaxed);
+        notifier[index].dropped.fetch_add(1, std::memory_order_relaxed);
+    }
 }
 
 }  // namespace ipc
@@ -0,0 +1,149 @@
+#include "rix/ipc/signal_set.hpp"
+
+#include <pthread.h>
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <system_error>
+
+namespace rix {
+namespace ipc {
+
+SignalSet::SignalSet(std::initializer_list<int> signums) : signums_(signums) {
+    std::memset(&info_, 0, sizeof(info_));
+    sigemptyset(&mask_);
+    sigemptyset(&blocked_);
+
+    if (signums_.empty()) {
+        throw std::invalid_argument("Signal set must not be empty");
+    }
+
+    for (int signum : signums_) {
+        if (signum == SIGKILL || signum == SIGSTOP || sigaddset(&mask_, signum) < 0) {
+            throw std::invalid_argument("Invalid signal number in signal set");
+        }
+    }
+
+    sigset_t previous;
+    int err = pthread_sigmask(SIG_BLOCK, &mask_, &previous);
+    if (err != 0) {
+        throw std::system_error(err, std::generic_category(), "Failed to block signal set");
+    }
+
+    // Only the signals blocked by this object are unblocked on destruction
+    for (int signum : signums_) {
+        if (!sigismember(&previous, signum)) {
+            sigaddset(&blocked_, signum);
+        }
+    }
+
+    int fd = ::signalfd(-1, &mask_, SFD_NONBLOCK | SFD_CLOEXEC);
+    if (fd < 0) {
+        err = errno;
+        pthread_sigmask(SIG_UNBLOCK, &blocked_, nullptr);
+        throw std::system_error(err, std::generic_category(), "Failed to create signalfd");
+    }
+    file_ = File(fd);
+}
+
+SignalSet::~SignalSet() { reset(); }
+
+SignalSet::SignalSet(SignalSet &&other)
+    : file_(std::move(other.file_)), mask_(other.mask_), blocked_(other.blocked_),
+      signums_(std::move(other.signums_)), info_(other.info_) {
+    sigemptyset(&other.mask_);
+    sigemptyset(&other.blocked_);
+    other.signums_.clear();
+}
+
+SignalSet &SignalSet::operator=(SignalSet &&other) {
+    if (this == &other) {
+        return *this;
+    }
+
+    reset();
+    file_ = std::move(other.file_);
+    mask_ = other.mask_;
+    blocked_ = other.blocked_;
+    signums_ = std::move(other.signums_);
+    info_ = other.info_;
+
+    sigemptyset(&other.mask_);
+    sigemptyset(&other.blocked_);
+    other.signums_.clear();
+    return *this;
+}
+
+void SignalSet::reset() {
+    if (!file_.ok()) {
+        return;
+    }
+
+    // Discard pending signals, otherwise unblocking would deliver them with
+    // their default action
+    struct signalfd_siginfo discard;
+    while (file_.read(reinterpret_cast<uint8_t *>(&discard), sizeof(discard)) == sizeof(discard)) {
+    }
+    file_ = File();
+    pthread_sigmask(SIG_UNBLOCK, &blocked_, nullptr);
+
+    sigemptyset(&mask_);
+    sigemptyset(&blocked_);
+    signums_.clear();
+}
+
+bool SignalSet::raise() const {
+    if (!file_.ok()) {
+        return false;
+    }
+    return raise(signums_.front());
+}
+
+bool SignalSet::raise(int signum) const {
+    if (!file_.ok() || !contains(signum)) {
+        return false;
+    }
+    return ::raise(signum) == 0;
+}
+
+bool SignalSet::kill(pid_t pid, int signum) const {
+    if (!file_.ok() || !contains(signum)) {
+        return false;
+    }
+    return ::kill(pid, signum) == 0;
+}
+
+bool SignalSet::contains(int signum) const { return file_.ok() && sigismember(&mask_, signum) == 1; }
+
+std::vector<int> SignalSet::signums() const { return file_.ok() ? signums_ : std::vector<int>(); }
+
+bool SignalSet::wait(const rix::util::Duration &d) const {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    // The signalfd is non-blocking, so try to consume a pending signal before
+    // waiting for one
+    struct signalfd_siginfo info;
+    ssize_t n = file_.read(reinterpret_cast<uint8_t *>(&info), sizeof(info));
+    if (n != sizeof(info)) {
+        if (!file_.wait_for_readable(d)) {
+            return false;
+        }
+        n = file_.read(reinterpret_cast<uint8_t *>(&info), sizeof(info));
+    }
+
+    if (n != sizeof(info)) {
+        return false;
+    }
+    info_ = info;
+    return true;
+}
+
+const struct signalfd_siginfo &SignalSet::info() const { return info_; }
+
+int SignalSet::fd() const { return file_.fd(); }
+
+}  // namespace ipc
+}  // namespace rix
@@ -0,0 +1,158 @@
+#include "rix/ipc/timer_fd.hpp"
+
+#include <sys/ioctl.h>
+#include <time.h>
+
+#ifndef TFD_IOC_SET_TICKS
+#define TFD_IOC_SET_TICKS _IOW('T', 0, uint64_t)
+#endif
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+struct timespec to_timespec(const rix::util::Duration &d) {
+    int64_t ns = d.to_nanoseconds();
+    if (ns < 0) {
+        ns = 0;
+    }
+    struct timespec ts;
+    ts.tv_sec = ns / 1000000000;
+    ts.tv_nsec = ns % 1000000000;
+    return ts;
+}
+
+rix::util::Duration to_duration(const struct timespec &ts) {
+    return rix::util::Duration(std::chrono::nanoseconds(ts.tv_sec * 1000000000LL + ts.tv_nsec));
+}
+
+}  // namespace
+
+rix::util::Duration TimerFd::now() {
+    struct timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return to_duration(ts);
+}
+
+TimerFd::TimerFd() : expirations_(0), overruns_(0) {
+    int fd = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (fd >= 0) {
+        file_ = File(fd);
+    }
+}
+
+bool TimerFd::start(const rix::util::Duration &delay, const rix::util::Duration &period) {
+    // A zero value would disarm the timer
+    if (delay.to_nanoseconds() <= 0) {
+        return false;
+    }
+    return arm(delay, period, 0);
+}
+
+bool TimerFd::start_at(const rix::util::Duration &deadline, const rix::util::Duration &period) {
+    // A zero value would disarm the timer, so clamp to the earliest deadline
+    rix::util::Duration value = deadline;
+    if (value.to_nanoseconds() <= 0) {
+        value = rix::util::Duration(std::chrono::nanoseconds(1));
+    }
+    return arm(value, period, TFD_TIMER_ABSTIME);
+}
+
+bool TimerFd::arm(const rix::util::Duration &value, const rix::util::Duration &period, int flags) {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    struct itimerspec spec;
+    spec.it_value = to_timespec(value);
+    spec.it_interval = to_timespec(period);
+    if (::timerfd_settime(file_.fd(), flags, &spec, nullptr) < 0) {
+        return false;
+    }
+    expirations_ = 0;
+    overruns_ = 0;
+    return true;
+}
+
+bool TimerFd::stop() {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    struct itimerspec spec = {};
+    return ::timerfd_settime(file_.fd(), 0, &spec, nullptr) == 0;
+}
+
+bool TimerFd::is_armed() const { return remaining().to_nanoseconds() > 0; }
+
+rix::util::Duration TimerFd::remaining() const {
+    struct itimerspec spec = {};
+    if (!file_.ok() || ::timerfd_gettime(file_.fd(), &spec) < 0) {
+        return rix::util::Duration(0.0);
+    }
+    return to_duration(spec.it_value);
+}
+
+rix::util::Duration TimerFd::period() const {
+    struct itimerspec spec = {};
+    if (!file_.ok() || ::timerfd_gettime(file_.fd(), &spec) < 0) {
+        return rix::util::Duration(0.0);
+    }
+    return to_duration(spec.it_interval);
+}
+
+bool TimerFd::raise() const {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    uint64_t ticks = 1;
+    if (::ioctl(file_.fd(), TFD_IOC_SET_TICKS, &ticks) == 0) {
+        return true;
+    }
+
+    // TFD_IOC_SET_TICKS requires CONFIG_CHECKPOINT_RESTORE, otherwise re-arm
+    // to expire as soon as possible, which replaces the schedule but keeps
+    // the period
+    struct itimerspec spec = {};
+    ::timerfd_gettime(file_.fd(), &spec);
+    spec.it_value.tv_sec = 0;
+    spec.it_value.tv_nsec = 1;
+    return ::timerfd_settime(file_.fd(), 0, &spec, nullptr) == 0;
+}
+
+bool TimerFd::wait(const rix::util::Duration &d) const {
+    if (!file_.ok()) {
+        return false;
+    }
+
+    // The timerfd is non-blocking, so try to consume the expirations before
+    // waiting for the timer to expire
+    uint64_t count;
+    ssize_t n = file_.read(reinterpret_cast<uint8_t *>(&count), sizeof(count));
+    if (n != sizeof(count)) {
+        if (!file_.wait_for_readable(d)) {
+            return false;
+        }
+        n = file_.read(reinterpret_cast<uint8_t *>(&count), sizeof(count));
+    }
+
+    if (n != sizeof(count) || count == 0) {
+        return false;
+    }
+    expirations_ = count;
+    overruns_ += count - 1;
+    return true;
+}
+
+uint64_t TimerFd::expirations() const { return expirations_; }
+
+uint64_t TimerFd::overruns() const { return overruns_; }
+
+bool TimerFd::ok() const { return file_.ok(); }
+
+int TimerFd::fd() const { return file_.fd(); }
+
+}  // namespace ipc
+}  // namespace rix
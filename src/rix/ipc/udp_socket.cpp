@@ -0,0 +1,164 @@
+#include "rix/ipc/udp_socket.hpp"
+
+#include <arpa/inet.h>
+#include <netinet/ip.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+bool make_address(const std::string &address, uint16_t port, struct sockaddr_in &addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (::inet_pton(AF_INET, address.c_str(), &addr.sin_addr) != 1) {
+        errno = EINVAL;
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+UdpSocket::UdpSocket() : File() {}
+
+UdpSocket::UdpSocket(const std::string &address, uint16_t port, bool nonblocking) : File() {
+    struct sockaddr_in addr;
+    if (!make_address(address, port, addr)) {
+        return;
+    }
+
+    int fd = ::socket(AF_INET, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return;
+    }
+
+    // Several receivers on one host may join the same multicast group
+    int reuse = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        ::close(fd);
+        return;
+    }
+
+    fd_ = fd;
+    if (nonblocking) {
+        set_nonblocking(true);
+    }
+}
+
+bool UdpSocket::connect(const std::string &address, uint16_t port) {
+    struct sockaddr_in addr;
+    if (fd_ < 0 || !make_address(address, port, addr)) {
+        return false;
+    }
+    return ::connect(fd_, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) == 0;
+}
+
+bool UdpSocket::join_group(const std::string &group, const std::string &interface) {
+    struct ip_mreq mreq;
+    if (fd_ < 0 || ::inet_pton(AF_INET, group.c_str(), &mreq.imr_multiaddr) != 1 ||
+        ::inet_pton(AF_INET, interface.c_str(), &mreq.imr_interface) != 1) {
+        return false;
+    }
+    return ::setsockopt(fd_, IPPROTO_IP, IP_ADD_MEMBERSHIP, &mreq, sizeof(mreq)) == 0;
+}
+
+bool UdpSocket::set_multicast_interface(const std::string &interface, bool loopback) {
+    struct in_addr addr;
+    if (fd_ < 0 || ::inet_pton(AF_INET, interface.c_str(), &addr) != 1) {
+        return false;
+    }
+
+    unsigned char loop = loopback ? 1 : 0;
+    return ::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_IF, &addr, sizeof(addr)) == 0 &&
+           ::setsockopt(fd_, IPPROTO_IP, IP_MULTICAST_LOOP, &loop, sizeof(loop)) == 0;
+}
+
+bool UdpSocket::set_busy_poll(int usec) {
+    if (fd_ < 0) {
+        return false;
+    }
+    return ::setsockopt(fd_, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec)) == 0;
+}
+
+bool UdpSocket::set_low_latency() {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    // Priority 6 is the highest available without CAP_NET_ADMIN
+    int priority = 6;
+    int tos = IPTOS_LOWDELAY;
+    return ::setsockopt(fd_, SOL_SOCKET, SO_PRIORITY, &priority, sizeof(priority)) == 0 &&
+           ::setsockopt(fd_, IPPROTO_IP, IP_TOS, &tos, sizeof(tos)) == 0;
+}
+
+uint16_t UdpSocket::port() const {
+    struct sockaddr_in addr;
+    socklen_t len = sizeof(addr);
+    if (fd_ < 0 || ::getsockname(fd_, reinterpret_cast<struct sockaddr *>(&addr), &len) < 0) {
+        return 0;
+    }
+    return ntohs(addr.sin_port);
+}
+
+int UdpSocket::send_batch(const std::vector<std::vector<uint8_t>> &messages) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    if (messages.empty()) {
+        return 0;
+    }
+
+    std::vector<struct iovec> iov(messages.size());
+    std::vector<struct mmsghdr> hdrs(messages.size());
+    for (size_t i = 0; i < messages.size(); i++) {
+        iov[i].iov_base = const_cast<uint8_t *>(messages[i].data());
+        iov[i].iov_len = messages[i].size();
+        std::memset(&hdrs[i], 0, sizeof(hdrs[i]));
+        hdrs[i].msg_hdr.msg_iov = &iov[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+    }
+    return ::sendmmsg(fd_, hdrs.data(), hdrs.size(), 0);
+}
+
+int UdpSocket::recv_batch(std::vector<std::vector<uint8_t>> &messages, size_t max_messages, size_t max_size) const {
+    if (fd_ < 0 || max_messages == 0) {
+        return -1;
+    }
+
+    messages.resize(max_messages);
+    std::vector<struct iovec> iov(max_messages);
+    std::vector<struct mmsghdr> hdrs(max_messages);
+    for (size_t i = 0; i < max_messages; i++) {
+        messages[i].resize(max_size);
+        iov[i].iov_base = messages[i].data();
+        iov[i].iov_len = max_size;
+        std::memset(&hdrs[i], 0, sizeof(hdrs[i]));
+        hdrs[i].msg_hdr.msg_iov = &iov[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // MSG_WAITFORONE blocks for the first datagram only
+    int n = ::recvmmsg(fd_, hdrs.data(), max_messages, MSG_WAITFORONE, nullptr);
+    if (n < 0) {
+        messages.clear();
+        return -1;
+    }
+
+    for (int i = 0; i < n; i++) {
+        messages[i].resize(hdrs[i].msg_len);
+    }
+    messages.resize(n);
+    return n;
+}
+
+}  // namespace ipc
+}  // namespace rix
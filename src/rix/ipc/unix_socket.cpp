@@ -0,0 +1,201 @@
+#include "rix/ipc/unix_socket.hpp"
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+namespace rix {
+namespace ipc {
+
+namespace {
+
+bool make_address(const std::string &pathname, struct sockaddr_un &addr) {
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (pathname.empty() || pathname.size() >= sizeof(addr.sun_path)) {
+        errno = ENAMETOOLONG;
+        return false;
+    }
+    std::memcpy(addr.sun_path, pathname.c_str(), pathname.size() + 1);
+    return true;
+}
+
+}  // namespace
+
+std::array<UnixSocket, 2> UnixSocket::pair() {
+    int fds[2];
+    if (::socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, fds) < 0) {
+        return {};
+    }
+    return {UnixSocket(fds[0]), UnixSocket(fds[1])};
+}
+
+UnixSocket::UnixSocket() : File() {}
+
+UnixSocket::UnixSocket(int fd) : File(fd) {}
+
+UnixSocket::UnixSocket(const std::string &pathname, bool nonblocking) : File() {
+    struct sockaddr_un addr;
+    if (!make_address(pathname, addr)) {
+        return;
+    }
+
+    int fd = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return;
+    }
+
+    if (::connect(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0) {
+        ::close(fd);
+        return;
+    }
+
+    fd_ = fd;
+    if (nonblocking) {
+        set_nonblocking(true);
+    }
+}
+
+ssize_t UnixSocket::write(const uint8_t *src, size_t size) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    return ::send(fd_, src, size, MSG_NOSIGNAL);
+}
+
+ssize_t UnixSocket::writev(const struct iovec *iov, int iovcnt) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+
+    struct msghdr msg;
+    std::memset(&msg, 0, sizeof(msg));
+    msg.msg_iov = const_cast<struct iovec *>(iov);
+    msg.msg_iovlen = iovcnt;
+    return ::sendmsg(fd_, &msg, MSG_NOSIGNAL);
+}
+
+int UnixSocket::recv_batch(std::vector<std::vector<uint8_t>> &messages, size_t max_messages, size_t max_size) const {
+    if (fd_ < 0 || max_messages == 0) {
+        return -1;
+    }
+
+    messages.resize(max_messages);
+    std::vector<struct iovec> iov(max_messages);
+    std::vector<struct mmsghdr> hdrs(max_messages);
+    for (size_t i = 0; i < max_messages; i++) {
+        messages[i].resize(max_size);
+        iov[i].iov_base = messages[i].data();
+        iov[i].iov_len = max_size;
+        std::memset(&hdrs[i], 0, sizeof(hdrs[i]));
+        hdrs[i].msg_hdr.msg_iov = &iov[i];
+        hdrs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    // MSG_WAITFORONE blocks for the first message only
+    int n = ::recvmmsg(fd_, hdrs.data(), max_messages, MSG_WAITFORONE, nullptr);
+    if (n < 0) {
+        messages.clear();
+        return -1;
+    }
+
+    // Once the peer has closed, every further receive returns an empty
+    // message, so trailing empty messages mark end of file
+    while (n > 0 && hdrs[n - 1].msg_len == 0) {
+        n--;
+    }
+    if (n == 0) {
+        messages.clear();
+        return 0;
+    }
+
+    for (int i = 0; i < n; i++) {
+        messages[i].resize(hdrs[i].msg_len);
+    }
+    messages.resize(n);
+    return n;
+}
+
+pid_t UnixSocket::peer_pid() const {
+    struct ucred cred;
+    socklen_t len = sizeof(cred);
+    if (fd_ < 0 || ::getsockopt(fd_, SOL_SOCKET, SO_PEERCRED, &cred, &len) < 0) {
+        return -1;
+    }
+    return cred.pid;
+}
+
+UnixListener::UnixListener() : File() {}
+
+UnixListener::UnixListener(const std::string &pathname, int backlog, bool nonblocking) : File() {
+    struct sockaddr_un addr;
+    if (!make_address(pathname, addr)) {
+        return;
+    }
+
+    int fd = ::socket(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return;
+    }
+
+    // Replace a socket file left behind by a previous listener
+    ::unlink(pathname.c_str());
+    if (::bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0 || ::listen(fd, backlog) < 0) {
+        ::close(fd);
+        return;
+    }
+
+    fd_ = fd;
+    pathname_ = pathname;
+    if (nonblocking) {
+        set_nonblocking(true);
+    }
+}
+
+UnixListener::UnixListener(UnixListener &&src) : File(std::move(src)), pathname_(std::move(src.pathname_)) {
+    src.pathname_.clear();
+}
+
+UnixListener &UnixListener::operator=(UnixListener &&src) {
+    if (this == &src) {
+        return *this;
+    }
+
+    close();
+    File::operator=(std::move(src));
+    pathname_ = std::move(src.pathname_);
+    src.pathname_.clear();
+    return *this;
+}
+
+UnixListener::~UnixListener() { close(); }
+
+void UnixListener::close() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+        fd_ = -1;
+    }
+    if (!pathname_.empty()) {
+        ::unlink(pathname_.c_str());
+        pathname_.clear();
+    }
+}
+
+UnixSocket UnixListener::accept(bool nonblocking) const {
+    if (fd_ < 0) {
+        return UnixSocket();
+    }
+
+    int fd = ::accept4(fd_, nullptr, nullptr, SOCK_CLOEXEC | (nonblocking ? SOCK_NONBLOCK : 0));
+    if (fd < 0) {
+        return UnixSocket();
+    }
+    return UnixSocket(fd);
+}
+
+std::string UnixListener::pathname() const { return pathname_; }
+
+}  // namespace ipc
+}  // namespace rix
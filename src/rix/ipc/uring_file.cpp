@@ -0,0 +1,398 @@
+#include "rix/ipc/uring_file.hpp"
+
+#include <limits.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#define RIX_IPC_HAVE_IO_URING 1
+#else
+#define RIX_IPC_HAVE_IO_URING 0
+#endif
+
+namespace rix {
+namespace ipc {
+
+#if RIX_IPC_HAVE_IO_URING
+
+/**
+ * @brief Minimal io_uring instance driven with raw system calls. Submissions
+ * are only published to the kernel by `submit`, which waits for every
+ * submitted operation to complete, so the completion queue can never overflow.
+ *
+ */
+struct UringFile::Ring {
+    ~Ring() {
+        if (sqes) ::munmap(sqes, sqes_size);
+        if (cq_ptr && cq_ptr != sq_ptr) ::munmap(cq_ptr, cq_size);
+        if (sq_ptr) ::munmap(sq_ptr, sq_size);
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool setup(unsigned entries) {
+        if (entries == 0) {
+            return false;
+        }
+
+        struct io_uring_params p;
+        std::memset(&p, 0, sizeof(p));
+        fd = ::syscall(__NR_io_uring_setup, entries, &p);
+        if (fd < 0) {
+            return false;
+        }
+
+        // IORING_OP_READ/WRITE at the current file position require 5.6+
+        if (!(p.features & IORING_FEAT_RW_CUR_POS)) {
+            return false;
+        }
+
+        sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+        cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+        const bool single_mmap = p.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_size = cq_size = std::max(sq_size, cq_size);
+        }
+
+        void *ptr = ::mmap(nullptr, sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                           IORING_OFF_SQ_RING);
+        if (ptr == MAP_FAILED) {
+            return false;
+        }
+        sq_ptr = static_cast<uint8_t *>(ptr);
+
+        if (single_mmap) {
+            cq_ptr = sq_ptr;
+        } else {
+            ptr = ::mmap(nullptr, cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd,
+                         IORING_OFF_CQ_RING);
+            if (ptr == MAP_FAILED) {
+                return false;
+            }
+            cq_ptr = static_cast<uint8_t *>(ptr);
+        }
+
+        sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+        ptr = ::mmap(nullptr, sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, IORING_OFF_SQES);
+        if (ptr == MAP_FAILED) {
+            return false;
+        }
+        sqes = static_cast<struct io_uring_sqe *>(ptr);
+
+        sq_head = reinterpret_cast<unsigned *>(sq_ptr + p.sq_off.head);
+        sq_tail = reinterpret_cast<unsigned *>(sq_ptr + p.sq_off.tail);
+        sq_mask = *reinterpret_cast<unsigned *>(sq_ptr + p.sq_off.ring_mask);
+        sq_array = reinterpret_cast<unsigned *>(sq_ptr + p.sq_off.array);
+        sq_entries = p.sq_entries;
+        cq_head = reinterpret_cast<unsigned *>(cq_ptr + p.cq_off.head);
+        cq_tail = reinterpret_cast<unsigned *>(cq_ptr + p.cq_off.tail);
+        cq_mask = *reinterpret_cast<unsigned *>(cq_ptr + p.cq_off.ring_mask);
+        cqes = reinterpret_cast<struct io_uring_cqe *>(cq_ptr + p.cq_off.cqes);
+        tail = *sq_tail;
+        return true;
+    }
+
+    bool full() const { return pending == sq_entries; }
+
+    /**
+     * @brief Prepares the next submission queue entry. Consecutive entries
+     * are linked so that they execute in order. A short transfer or a failure
+     * ends the chain, and the kernel completes the rest with -ECANCELED.
+     */
+    void prep(uint8_t opcode, int file, const void *addr, unsigned len) {
+        if (last) {
+            last->flags |= IOSQE_IO_LINK;
+        }
+
+        const unsigned index = tail & sq_mask;
+        struct io_uring_sqe *sqe = &sqes[index];
+        std::memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = opcode;
+        sqe->fd = file;
+        sqe->addr = reinterpret_cast<uint64_t>(addr);
+        sqe->len = len;
+        sqe->off = static_cast<uint64_t>(-1);  // Use (and advance) the file position
+        sq_array[index] = index;
+
+        last = sqe;
+        tail++;
+        pending++;
+    }
+
+    /**
+     * @brief Publishes the pending entries, enters the kernel once to submit
+     * them, and reaps completions in batches until all have completed. Returns
+     * the bytes transferred before the chain ended, or -1 if the first
+     * operation failed.
+     */
+    ssize_t submit() {
+        if (pending == 0) {
+            return 0;
+        }
+
+        std::atomic_ref<unsigned>(*sq_tail).store(tail, std::memory_order_release);
+
+        const unsigned count = pending;
+        pending = 0;
+        last = nullptr;
+
+        unsigned to_submit = count;
+        unsigned reaped = 0;
+        ssize_t total = 0;
+        int first_error = 0;
+        while (reaped < count) {
+            int ret = ::syscall(__NR_io_uring_enter, fd, to_submit, count - reaped, IORING_ENTER_GETEVENTS,
+                                nullptr, 0);
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return -1;
+            }
+            to_submit -= std::min<unsigned>(ret, to_submit);
+
+            unsigned head = *cq_head;
+            const unsigned cq_end = std::atomic_ref<unsigned>(*cq_tail).load(std::memory_order_acquire);
+            for (; head != cq_end; head++, reaped++) {
+                const int res = cqes[head & cq_mask].res;
+                if (res == -ECANCELED) {
+                    // Never ran because an earlier operation in the chain was
+                    // short or failed
+                    continue;
+                }
+                if (res < 0) {
+                    if (first_error == 0) first_error = -res;
+                } else {
+                    total += res;
+                }
+            }
+            std::atomic_ref<unsigned>(*cq_head).store(head, std::memory_order_release);
+        }
+
+        if (first_error != 0 && total == 0) {
+            errno = first_error;
+            return -1;
+        }
+        return total;
+    }
+
+    int fd = -1;
+    uint8_t *sq_ptr = nullptr;
+    uint8_t *cq_ptr = nullptr;
+    size_t sq_size = 0;
+    size_t cq_size = 0;
+    struct io_uring_sqe *sqes = nullptr;
+    size_t sqes_size = 0;
+
+    unsigned *sq_head = nullptr;
+    unsigned *sq_tail = nullptr;
+    unsigned *sq_array = nullptr;
+    unsigned sq_mask = 0;
+    unsigned sq_entries = 0;
+    unsigned *cq_head = nullptr;
+    unsigned *cq_tail = nullptr;
+    unsigned cq_mask = 0;
+    struct io_uring_cqe *cqes = nullptr;
+
+    unsigned tail = 0;    /**< Local submission tail, published by submit */
+    unsigned pending = 0; /**< Entries prepared since the last submit */
+    struct io_uring_sqe *last = nullptr;
+};
+
+#else
+
+struct UringFile::Ring {
+    bool setup(unsigned) { return false; }
+    bool full() const { return true; }
+    void prep(uint8_t, int, const void *, unsigned) {}
+    ssize_t submit() { return -1; }
+    unsigned pending = 0;
+};
+
+#endif
+
+std::unique_ptr<UringFile::Ring> UringFile::make_ring(int fd, unsigned queue_depth) {
+    if (fd < 0) {
+        return nullptr;
+    }
+    auto ring = std::make_unique<UringFile::Ring>();
+    if (!ring->setup(queue_depth)) {
+        return nullptr;
+    }
+    return ring;
+}
+
+UringFile::UringFile() : File() {}
+
+UringFile::UringFile(int fd, unsigned queue_depth) : File(fd), ring_(make_ring(fd_, queue_depth)) {}
+
+UringFile::UringFile(std::string pathname, int creation_flags, mode_t mode, unsigned queue_depth)
+    : File(pathname, creation_flags, mode), ring_(make_ring(fd_, queue_depth)) {}
+
+UringFile::UringFile(UringFile &&src)
+    : File(std::move(src)), ring_(std::move(src.ring_)), ops_(std::move(src.ops_)) {}
+
+UringFile &UringFile::operator=(UringFile &&src) {
+    if (this == &src) {
+        return *this;
+    }
+
+    flush();
+    ring_ = std::move(src.ring_);
+    ops_ = std::move(src.ops_);
+    File::operator=(std::move(src));
+    return *this;
+}
+
+UringFile::~UringFile() {
+    flush();
+    ring_.reset();
+}
+
+ssize_t UringFile::read(uint8_t *dst, size_t size) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    if (!ring_) {
+        if (!ops_.empty() && flush() < 0) return -1;
+        return File::read(dst, size);
+    }
+    if (ring_->pending > 0 && flush() < 0) {
+        return -1;
+    }
+#if RIX_IPC_HAVE_IO_URING
+    ring_->prep(IORING_OP_READ, fd_, dst, size);
+#endif
+    return ring_->submit();
+}
+
+ssize_t UringFile::write(const uint8_t *src, size_t size) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    if (!ring_) {
+        if (!ops_.empty() && flush() < 0) return -1;
+        return File::write(src, size);
+    }
+    if (ring_->pending > 0 && flush() < 0) {
+        return -1;
+    }
+#if RIX_IPC_HAVE_IO_URING
+    ring_->prep(IORING_OP_WRITE, fd_, src, size);
+#endif
+    return ring_->submit();
+}
+
+ssize_t UringFile::readv(const struct iovec *iov, int iovcnt) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    if (!ring_) {
+        if (!ops_.empty() && flush() < 0) return -1;
+        return File::readv(iov, iovcnt);
+    }
+    if (ring_->pending > 0 && flush() < 0) {
+        return -1;
+    }
+#if RIX_IPC_HAVE_IO_URING
+    ring_->prep(IORING_OP_READV, fd_, iov, iovcnt);
+#endif
+    return ring_->submit();
+}
+
+ssize_t UringFile::writev(const struct iovec *iov, int iovcnt) const {
+    if (fd_ < 0) {
+        return -1;
+    }
+    if (!ring_) {
+        if (!ops_.empty() && flush() < 0) return -1;
+        return File::writev(iov, iovcnt);
+    }
+    if (ring_->pending > 0 && flush() < 0) {
+        return -1;
+    }
+#if RIX_IPC_HAVE_IO_URING
+    ring_->prep(IORING_OP_WRITEV, fd_, iov, iovcnt);
+#endif
+    return ring_->submit();
+}
+
+bool UringFile::queue_read(uint8_t *dst, size_t size) {
+    struct iovec iov;
+    iov.iov_base = dst;
+    iov.iov_len = size;
+    return queue(false, iov);
+}
+
+bool UringFile::queue_write(const uint8_t *src, size_t size) {
+    struct iovec iov;
+    iov.iov_base = const_cast<uint8_t *>(src);
+    iov.iov_len = size;
+    return queue(true, iov);
+}
+
+bool UringFile::queue(bool write, const struct iovec &iov) const {
+    if (fd_ < 0) {
+        return false;
+    }
+
+    if (!ring_) {
+        ops_.push_back({write, iov});
+        return true;
+    }
+
+    if (ring_->full() && flush() < 0) {
+        return false;
+    }
+#if RIX_IPC_HAVE_IO_URING
+    ring_->prep(write ? IORING_OP_WRITE : IORING_OP_READ, fd_, iov.iov_base, iov.iov_len);
+#endif
+    return true;
+}
+
+ssize_t UringFile::flush() const {
+    if (ring_) {
+        return ring_->submit();
+    }
+
+    // Fallback: gather runs of the same kind of operation into one syscall
+    ssize_t total = 0;
+    std::vector<struct iovec> iovs;
+    size_t i = 0;
+    while (i < ops_.size()) {
+        const bool write = ops_[i].write;
+        size_t size = 0;
+        iovs.clear();
+        while (i < ops_.size() && ops_[i].write == write && iovs.size() < IOV_MAX) {
+            size += ops_[i].iov.iov_len;
+            iovs.push_back(ops_[i++].iov);
+        }
+        ssize_t n = write ? File::writev(iovs.data(), iovs.size()) : File::readv(iovs.data(), iovs.size());
+        if (n < 0) {
+            ops_.clear();
+            return total > 0 ? total : -1;
+        }
+        total += n;
+
+        // A short transfer ends the batch, as it does on the ring
+        if (static_cast<size_t>(n) < size) {
+            break;
+        }
+    }
+    ops_.clear();
+    return total;
+}
+
+size_t UringFile::queued() const { return ring_ ? ring_->pending : ops_.size(); }
+
+bool UringFile::is_uring() const { return ring_ != nullptr; }
+
+}  // namespace ipc
+}  // namespace rix
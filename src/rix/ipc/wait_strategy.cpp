@@ -0,0 +1,37 @@
+#include "rix/ipc/wait_strategy.hpp"
+
+#include <time.h>
+
+namespace rix {
+namespace ipc {
+
+bool WaitStrategy::block(int fd, short events, const rix::util::Duration &timeout) {
+    if (fd < 0) {
+        return false;
+    }
+
+    struct pollfd pfd;
+    pfd.fd = fd;
+    pfd.events = events;
+    pfd.revents = 0;
+
+    // ppoll takes a timespec, so timeouts below a millisecond are honored
+    // instead of rounding down to a non-blocking check
+    struct timespec ts;
+    struct timespec *tsp = nullptr;
+    if (timeout != rix::util::Duration::max()) {
+        int64_t ns = timeout.to_nanoseconds();
+        if (ns < 0) {
+            ns = 0;
+        }
+        ts.tv_sec = ns / 1000000000;
+        ts.tv_nsec = ns % 1000000000;
+        tsp = &ts;
+    }
+
+    int ret = ::ppoll(&pfd, 1, tsp, nullptr);
+    return (ret > 0) && (pfd.revents & events);
+}
+
+}  // namespace ipc
+}  // namespace rix
@@ -48,6 +48,12 @@ Time Time::now() {
     return time;
 }
 
+Time Time::monotonic_now() {
+    Time time;
+    time.tp = Type(std::chrono::steady_clock::now().time_since_epoch());
+    return time;
+}
+
 Time::Time() : tp{} {}
 
 Time::Time(const Type &time_point) : tp(time_point) {}
@@ -73,6 +79,14 @@ Time &Time::operator=(const Time &other) {
     return *this;
 }
 
+Duration Time::remaining() const {
+    if (*this == Time::max()) {
+        return Duration::max();
+    }
+    Time now = Time::monotonic_now();
+    return (*this > now) ? *this - now : Duration(0);
+}
+
 Time Time::operator+(const Duration &other) const { return Time(tp + other.get()); }
 
 Time Time::operator-(const Duration &other) const { return Time(tp - other.get()); }
@@ -1,6 +1,7 @@
 #include "rix/ipc/fifo.hpp"
 #include "rix/ipc/file.hpp"
 #include "rix/ipc/signal.hpp"
+#include "rix/ipc/udp_socket.hpp"
 #include "rix/msg/geometry/Twist2DStamped.hpp"
 #include "rix/msg/standard/UInt32.hpp"
 #include "rix/util/argument_parser.hpp"
@@ -16,6 +17,8 @@ int main(int argc, char **argv) {
                           "Sends drive commands to stdout corresponding to characters written to FIFO.");
     parser.add<double>("linear_speed", "Linear speed to drive the MBot (m/s)", 'l', 0.25);
     parser.add<double>("angular_speed", "Angular speed to drive the MBot (rad/s)", 'a', 1.570796);
+    parser.add<std::string>("host", "Send commands over UDP to this IPv4 or multicast address instead of stdout", 'H', "");
+    parser.add<int>("port", "UDP port to send commands to", 'p', 0);
 
     if (!parser.parse(argc, argv)) {
         std::cerr << parser.help() << std::endl;
@@ -34,8 +37,35 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    auto input = std::make_unique<Fifo>("teleop", Fifo::Mode::READ);
-    auto output = std::make_unique<File>(STDOUT_FILENO);
+    std::string host;
+    if (!parser.get<std::string>("host", host)) {
+        std::cerr << "Failed to get host argument." << std::endl;
+        return 1;
+    }
+
+    int port;
+    if (!parser.get<int>("port", port)) {
+        std::cerr << "Failed to get port argument." << std::endl;
+        return 1;
+    }
+
+    // Each command is written with a single gather write, so over UDP every
+    // command is one datagram and a lost command cannot delay the next one
+    std::unique_ptr<rix::ipc::interfaces::IO> output;
+    if (!host.empty()) {
+        auto socket = std::make_unique<UdpSocket>("0.0.0.0", 0);
+        if (!socket->ok() || !socket->connect(host, port)) {
+            std::cerr << "Failed to connect to " << host << ":" << port << "." << std::endl;
+            return 1;
+        }
+        socket->set_low_latency();
+        output = std::move(socket);
+    } else {
+        output = std::make_unique<File>(STDOUT_FILENO);
+    }
+
+    // Keyboard clients may connect and reconnect without restarting teleop
+    auto input = std::make_unique<Fifo>("teleop", Fifo::Mode::READ_PERSISTENT);
     TeleopKeyboard teleop_keyboard(std::move(input), std::move(output), linear_speed, angular_speed);
 
     auto notif = std::make_unique<Signal>(SIGINT);
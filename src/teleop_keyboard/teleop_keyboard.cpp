@@ -1,6 +1,9 @@
 #include "teleop_keyboard/teleop_keyboard.hpp"
+#include <array>
 #include <cctype>
+#include <cerrno>
 #include <vector>
+#include "rix/ipc/poller.hpp"
 #include "rix/msg/geometry/Twist2DStamped.hpp"
 #include "rix/msg/standard/UInt32.hpp"
 #include "rix/msg/serialization.hpp"
@@ -8,6 +11,17 @@
 
 using namespace rix::msg;
 
+namespace {
+
+constexpr char FRAME_ID[] = "mbot";
+
+// Serialized size of a command: the header's seq, stamp and frame id, then
+// the twist
+constexpr size_t MAX_MSG_SIZE = static_size_v<uint32_t> + static_size_v<standard::Time> + static_size_v<uint32_t> +
+                                sizeof(FRAME_ID) - 1 + static_size_v<geometry::Twist2D>;
+
+}  // namespace
+
 TeleopKeyboard::TeleopKeyboard(
     std::unique_ptr<rix::ipc::interfaces::IO> input,
     std::unique_ptr<rix::ipc::interfaces::IO> output,
@@ -16,13 +30,21 @@ TeleopKeyboard::TeleopKeyboard(
     : input(std::move(input)),
       output(std::move(output)),
       linear_speed(linear_speed),
-      angular_speed(angular_speed) {}
+      angular_speed(angular_speed),
+      seq(0) {}
 
 void TeleopKeyboard::spin(
     std::unique_ptr<rix::ipc::interfaces::Notification> notif) {
-    uint32_t seq = 0;
+    // Sleep in a single kernel wait on both the input and the notification
+    // when both are pollable
+    rix::ipc::Poller poller;
+    bool pollable = poller.add(*input) && poller.add(*notif);
     
     while (true) {
+        if (pollable) {
+            poller.wait(rix::util::Duration::max());
+        }
+        
         if (notif->is_ready()) {
             return;
         }
@@ -38,73 +60,101 @@ void TeleopKeyboard::spin(
             continue;
         }
         
-        char key = static_cast<char>(char_buffer);
-        
-        geometry::Twist2DStamped twist_cmd;
-        bool valid_key = true;
-        
-        switch (key) {
-            case 'W':
-            case 'w':
-                twist_cmd.twist.vx = linear_speed;
-                break;
-            case 'A':
-            case 'a':
-                twist_cmd.twist.vy = linear_speed;
-                break;
-            case 'S':
-            case 's':
-                twist_cmd.twist.vx = -linear_speed;
-                break;
-            case 'D':
-            case 'd':
-                twist_cmd.twist.vy = -linear_speed;
-                break;
-            case 'Q':
-            case 'q':
-                twist_cmd.twist.wz = angular_speed;
-                break;
-            case 'E':
-            case 'e':
-                twist_cmd.twist.wz = -angular_speed;
-                break;
-            case ' ':
-                // Space sends zero twist (already initialized to 0)
-                break;
-            default:
-                // Ignore invalid keys
-                valid_key = false;
-                break;
-        }
-        
-        if (!valid_key) {
-            continue;
-        }
-        
-        twist_cmd.header.seq = seq++;
-        twist_cmd.header.frame_id = "mbot";
-        twist_cmd.header.stamp = rix::util::Time::now().to_msg();
-        
-        size_t msg_size = twist_cmd.size();
-        
-        standard::UInt32 size_msg;
-        size_msg.data = static_cast<uint32_t>(msg_size);
-        std::vector<uint8_t> size_buffer(4);
-        size_t offset = 0;
-        size_msg.serialize(size_buffer.data(), offset);
-        
-        ssize_t written = output->write(size_buffer.data(), size_buffer.size());
-        if (written < 0) {
-            continue;
+        send_key(static_cast<char>(char_buffer));
+    }
+}
+
+void TeleopKeyboard::spin_async(std::unique_ptr<rix::ipc::interfaces::Notification> notif) {
+    rix::ipc::coro::Scheduler scheduler;
+    scheduler.spawn(read_keys(scheduler));
+    scheduler.spawn([](const rix::ipc::interfaces::Notification &notif,
+                       rix::ipc::coro::Scheduler &scheduler) -> rix::ipc::coro::Task<void> {
+        co_await rix::ipc::coro::async_wait(notif);
+        scheduler.stop();
+    }(*notif, scheduler));
+    scheduler.run();
+}
+
+rix::ipc::coro::Task<void> TeleopKeyboard::read_keys(rix::ipc::coro::Scheduler &scheduler) {
+    while (true) {
+        co_await rix::ipc::coro::readable(*input);
+
+        uint8_t char_buffer;
+        ssize_t bytes_read = input->read(&char_buffer, 1);
+        if (bytes_read == 0 || (bytes_read < 0 && errno != EAGAIN && errno != EINTR)) {
+            scheduler.stop();
+            co_return;
         }
-        
-        std::vector<uint8_t> msg_buffer(msg_size);
-        offset = 0;
-        twist_cmd.serialize(msg_buffer.data(), offset);
-        
-        written = output->write(msg_buffer.data(), msg_buffer.size());
-        if (written < 0) {
+        if (bytes_read < 0) {
             continue;
         }
+
+        co_await rix::ipc::coro::writable(*output);
+        send_key(static_cast<char>(char_buffer));
     }
-}
\ No newline at end of file
+}
+
+bool TeleopKeyboard::send_key(char key) {
+    geometry::Twist2DStamped twist_cmd;
+    
+    switch (key) {
+        case 'W':
+        case 'w':
+            twist_cmd.twist.vx = linear_speed;
+            break;
+        case 'A':
+        case 'a':
+            twist_cmd.twist.vy = linear_speed;
+            break;
+        case 'S':
+        case 's':
+            twist_cmd.twist.vx = -linear_speed;
+            break;
+        case 'D':
+        case 'd':
+            twist_cmd.twist.vy = -linear_speed;
+            break;
+        case 'Q':
+        case 'q':
+            twist_cmd.twist.wz = angular_speed;
+            break;
+        case 'E':
+        case 'e':
+            twist_cmd.twist.wz = -angular_speed;
+            break;
+        case ' ':
+            // Space sends zero twist (already initialized to 0)
+            break;
+        default:
+            // Ignore invalid keys
+            return false;
+    }
+    
+    twist_cmd.header.seq = seq++;
+    twist_cmd.header.frame_id = FRAME_ID;
+    twist_cmd.header.stamp = rix::util::Time::now().to_msg();
+    
+    size_t msg_size = twist_cmd.size();
+    
+    standard::UInt32 size_msg;
+    size_msg.data = static_cast<uint32_t>(msg_size);
+    std::array<uint8_t, static_size_v<standard::UInt32>> size_buffer;
+    size_t offset = 0;
+    size_msg.serialize(size_buffer.data(), offset);
+    
+    std::array<uint8_t, MAX_MSG_SIZE> msg_buffer;
+    if (msg_size > msg_buffer.size()) {
+        return false;
+    }
+    offset = 0;
+    twist_cmd.serialize(msg_buffer.data(), offset);
+    
+    // Send the length prefix and the body in a single gather write
+    struct iovec iov[2];
+    iov[0].iov_base = size_buffer.data();
+    iov[0].iov_len = size_buffer.size();
+    iov[1].iov_base = msg_buffer.data();
+    iov[1].iov_len = msg_size;
+    
+    return output->writev(iov, 2) >= 0;
+}
@@ -0,0 +1,134 @@
+#include "rix/ipc/buffered_reader.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "mocks/mock_io.hpp"
+#include "rix/ipc/pipe.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+
+using namespace rix::ipc;
+
+std::vector<uint8_t> make_frame(const std::string &payload) {
+    rix::msg::standard::UInt32 length;
+    length.data = payload.size();
+    std::vector<uint8_t> frame(length.size() + payload.size());
+    size_t offset = 0;
+    length.serialize(frame.data(), offset);
+    std::memcpy(frame.data() + offset, payload.data(), payload.size());
+    return frame;
+}
+
+std::string to_string(const std::vector<uint8_t> &buffer) { return std::string(buffer.begin(), buffer.end()); }
+
+TEST(BufferedReaderTest, ReadsFramesFromPipe) {
+    auto [reader, writer] = Pipe::create();
+    for (const std::string payload : {"one", "two", "three"}) {
+        auto frame = make_frame(payload);
+        writer.write(frame.data(), frame.size());
+    }
+    writer = Pipe();
+
+    BufferedReader buffered(reader);
+    std::vector<uint8_t> frame;
+    EXPECT_EQ(buffered.read_frame(frame), 7);
+    EXPECT_EQ(to_string(frame), "one");
+    EXPECT_EQ(buffered.read_frame(frame), 7);
+    EXPECT_EQ(to_string(frame), "two");
+    EXPECT_EQ(buffered.read_frame(frame), 9);
+    EXPECT_EQ(to_string(frame), "three");
+    EXPECT_EQ(buffered.read_frame(frame), 0);
+}
+
+TEST(BufferedReaderTest, OneReadForManyFrames) {
+    testing::NiceMock<MockIO> io;
+    std::vector<uint8_t> stream;
+    for (int i = 0; i < 100; i++) {
+        auto frame = make_frame("frame" + std::to_string(i));
+        stream.insert(stream.end(), frame.begin(), frame.end());
+    }
+    io.write(stream.data(), stream.size());
+    io.close_write_end();
+
+    EXPECT_CALL(io, read).Times(2);  // One fill, then end of file
+    BufferedReader buffered(io);
+    std::vector<uint8_t> frame;
+    for (int i = 0; i < 100; i++) {
+        ASSERT_GT(buffered.read_frame(frame), 0);
+        EXPECT_EQ(to_string(frame), "frame" + std::to_string(i));
+    }
+    EXPECT_EQ(buffered.read_frame(frame), 0);
+}
+
+TEST(BufferedReaderTest, KeepsPartialFramesAcrossCalls) {
+    testing::NiceMock<MockIO> io;
+    io.set_nonblocking(true);
+    auto stream = make_frame("partial");
+
+    BufferedReader buffered(io);
+    std::vector<uint8_t> frame;
+
+    // Deliver the frame one byte at a time
+    for (size_t i = 0; i + 1 < stream.size(); i++) {
+        io.write(&stream[i], 1);
+        EXPECT_EQ(buffered.fill(), 1);
+        EXPECT_FALSE(buffered.has_frame());
+        EXPECT_FALSE(buffered.next_frame(frame));
+    }
+    io.write(&stream.back(), 1);
+    EXPECT_EQ(buffered.fill(), 1);
+    EXPECT_TRUE(buffered.has_frame());
+    EXPECT_TRUE(buffered.next_frame(frame));
+    EXPECT_EQ(to_string(frame), "partial");
+    EXPECT_EQ(buffered.size(), 0);
+}
+
+TEST(BufferedReaderTest, FramesWrapAroundBuffer) {
+    auto [reader, writer] = Pipe::create();
+    BufferedReader buffered(reader, 16);
+    std::vector<uint8_t> frame;
+
+    for (int i = 0; i < 50; i++) {
+        std::string payload(1 + i % 10, 'a' + i % 26);
+        auto data = make_frame(payload);
+        writer.write(data.data(), data.size());
+        ASSERT_EQ(buffered.read_frame(frame), data.size());
+        EXPECT_EQ(to_string(frame), payload);
+    }
+}
+
+TEST(BufferedReaderTest, RejectsOversizedFrame) {
+    auto [reader, writer] = Pipe::create();
+    auto data = make_frame(std::string(64, 'x'));
+    writer.write(data.data(), data.size());
+
+    BufferedReader buffered(reader, 32);
+    std::vector<uint8_t> frame;
+    errno = 0;
+    EXPECT_EQ(buffered.read_frame(frame), -1);
+    EXPECT_EQ(errno, EMSGSIZE);
+    EXPECT_EQ(buffered.size(), 0);
+}
+
+TEST(BufferedReaderTest, ResumesAfterOversizedFrame) {
+    auto [reader, writer] = Pipe::create();
+    auto data = make_frame(std::string(64, 'x'));
+    writer.write(data.data(), data.size());
+    data = make_frame("next");
+    writer.write(data.data(), data.size());
+    writer = Pipe();
+
+    BufferedReader buffered(reader, 32);
+    std::vector<uint8_t> frame;
+    errno = 0;
+    EXPECT_EQ(buffered.read_frame(frame), -1);
+    EXPECT_EQ(errno, EMSGSIZE);
+
+    // The rest of the oversized payload is skipped, not parsed as prefixes
+    EXPECT_EQ(buffered.read_frame(frame), 8);
+    EXPECT_EQ(to_string(frame), "next");
+    EXPECT_EQ(buffered.read_frame(frame), 0);
+}
@@ -0,0 +1,143 @@
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "rix/ipc/coro.hpp"
+#include "rix/ipc/event.hpp"
+#include "rix/ipc/pipe.hpp"
+
+using namespace rix::ipc;
+using rix::util::Duration;
+using rix::util::Time;
+
+namespace {
+
+coro::Task<int> answer() { co_return 42; }
+
+coro::Task<int> fail() {
+    throw std::runtime_error("fail");
+    co_return 0;
+}
+
+coro::Task<void> add_answer(int &out) { out += co_await answer(); }
+
+coro::Task<void> sleep_then_push(double seconds, int id, std::vector<int> &order) {
+    co_await coro::sleep_for(Duration(seconds));
+    order.push_back(id);
+}
+
+coro::Task<void> read_all(const Pipe &reader, std::string &out) {
+    uint8_t buffer[16];
+    while (true) {
+        ssize_t n = co_await coro::async_read(reader, buffer, sizeof(buffer));
+        if (n <= 0) {
+            co_return;
+        }
+        out.append(reinterpret_cast<char *>(buffer), n);
+    }
+}
+
+coro::Task<void> write_then_close(Pipe writer, std::string msg) {
+    for (char c : msg) {
+        uint8_t byte = c;
+        co_await coro::async_write(writer, &byte, 1);
+        co_await coro::sleep_for(Duration(0.001));
+    }
+}
+
+}  // namespace
+
+// Test that a nested task returns its result to the awaiting task
+TEST(CoroTest, NestedTaskResult) {
+    coro::Scheduler scheduler;
+    ASSERT_TRUE(scheduler.ok());
+    int out = 0;
+    scheduler.spawn(add_answer(out));
+    EXPECT_EQ(scheduler.size(), 1);
+    scheduler.run();
+    EXPECT_EQ(out, 42);
+    EXPECT_EQ(scheduler.size(), 0);
+}
+
+// Test that exceptions propagate through co_await and out of run
+TEST(CoroTest, ExceptionPropagates) {
+    coro::Scheduler scheduler;
+    scheduler.spawn([]() -> coro::Task<void> { co_await fail(); }());
+    EXPECT_THROW(scheduler.run(), std::runtime_error);
+}
+
+// Test that sleeping tasks resume in deadline order
+TEST(CoroTest, SleepOrder) {
+    coro::Scheduler scheduler;
+    std::vector<int> order;
+    scheduler.spawn(sleep_then_push(0.03, 3, order));
+    scheduler.spawn(sleep_then_push(0.01, 1, order));
+    scheduler.spawn(sleep_then_push(0.02, 2, order));
+
+    Time start = Time::now();
+    scheduler.run();
+    EXPECT_GE((Time::now() - start).to_milliseconds(), 30);
+    EXPECT_EQ(order, std::vector<int>({1, 2, 3}));
+}
+
+// Test that a reader and writer interleave on one thread through a pipe
+TEST(CoroTest, AsyncReadWritePipe) {
+    auto [reader, writer] = Pipe::create();
+    coro::Scheduler scheduler;
+    std::string out;
+    scheduler.spawn(read_all(reader, out));
+    scheduler.spawn(write_then_close(std::move(writer), "coroutine"));
+    scheduler.run();
+    EXPECT_EQ(out, "coroutine");
+}
+
+// Test that async_wait resumes when an Event is raised from another thread
+TEST(CoroTest, AsyncWaitEvent) {
+    Event event;
+    coro::Scheduler scheduler;
+    bool ready = false;
+    scheduler.spawn([](const Event &event, bool &ready) -> coro::Task<void> {
+        ready = co_await coro::async_wait(event);
+    }(event, ready));
+
+    std::thread raiser([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        event.raise();
+    });
+    scheduler.run();
+    raiser.join();
+    EXPECT_TRUE(ready);
+}
+
+// Test that stop returns from run with tasks still suspended
+TEST(CoroTest, Stop) {
+    auto [reader, writer] = Pipe::create();
+    coro::Scheduler scheduler;
+    std::string out;
+    scheduler.spawn(read_all(reader, out));
+    scheduler.spawn([](coro::Scheduler &scheduler) -> coro::Task<void> {
+        co_await coro::sleep_for(Duration(0.01));
+        scheduler.stop();
+    }(scheduler));
+    scheduler.run();
+    EXPECT_EQ(scheduler.size(), 1);
+    EXPECT_TRUE(out.empty());
+}
+
+// Test that a reader sees end of file once the write end is closed
+TEST(CoroTest, EndOfFile) {
+    EXPECT_EQ(coro::Scheduler::current(), nullptr);
+    auto [reader, writer] = Pipe::create();
+    uint8_t byte = 'x';
+    ASSERT_EQ(writer.write(&byte, 1), 1);
+    writer = Pipe();
+
+    coro::Scheduler scheduler;
+    std::string out;
+    scheduler.spawn(read_all(reader, out));
+    scheduler.run();
+    EXPECT_EQ(out, "x");
+    EXPECT_EQ(scheduler.size(), 0);
+}
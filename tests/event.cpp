@@ -0,0 +1,112 @@
+#include "rix/ipc/event.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+TEST(EventTest, Constructor) {
+    Event event;
+    EXPECT_TRUE(event.ok());
+    EXPECT_GE(event.fd(), 0);
+    EXPECT_EQ(event.mode(), Event::Mode::COUNTER);
+    EXPECT_FALSE(event.wait(rix::util::Duration(0)));
+}
+
+TEST(EventTest, InitialValue) {
+    Event event(Event::Mode::COUNTER, 3);
+    EXPECT_TRUE(event.is_ready());
+    EXPECT_EQ(event.count(), 3);
+    EXPECT_FALSE(event.is_ready());
+}
+
+TEST(EventTest, CounterModeConsumesAll) {
+    Event event;
+    EXPECT_TRUE(event.raise());
+    EXPECT_TRUE(event.raise(4));
+    EXPECT_TRUE(event.wait(rix::util::Duration(0)));
+    EXPECT_EQ(event.count(), 5);
+    EXPECT_FALSE(event.wait(rix::util::Duration(0)));
+    EXPECT_FALSE(event.raise(0));
+}
+
+TEST(EventTest, SemaphoreModeConsumesOne) {
+    Event event(Event::Mode::SEMAPHORE);
+    EXPECT_TRUE(event.raise(3));
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(event.is_ready());
+        EXPECT_EQ(event.count(), 1);
+    }
+    EXPECT_FALSE(event.is_ready());
+}
+
+TEST(EventTest, CopySharesCounter) {
+    Event event1;
+    Event event2(event1);
+    EXPECT_NE(event1.fd(), event2.fd());
+    EXPECT_TRUE(event1.raise());
+    EXPECT_TRUE(event2.is_ready());
+    EXPECT_FALSE(event1.is_ready());
+}
+
+TEST(EventTest, MoveConstructor) {
+    Event event1;
+    int fd = event1.fd();
+    Event event2(std::move(event1));
+    EXPECT_FALSE(event1.ok());
+    EXPECT_FALSE(event1.raise());
+    EXPECT_EQ(event2.fd(), fd);
+}
+
+TEST(EventTest, WaitTimesOut) {
+    Event event;
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_FALSE(event.wait(rix::util::Duration(0.1)));
+    timer.stop();
+    EXPECT_NEAR(timer.get().to_milliseconds(), 100, 50);
+}
+
+TEST(EventTest, WakesAnotherThread) {
+    Event event;
+    std::thread waker([&event]() {
+        rix::util::sleep_for(rix::util::Duration(0.05));
+        event.raise();
+    });
+
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_TRUE(event.wait(rix::util::Duration(1.0)));
+    timer.stop();
+    waker.join();
+    EXPECT_LT(timer.get().to_milliseconds(), 500);
+}
+
+TEST(EventTest, RegistersWithPoller) {
+    Event event;
+    Poller poller;
+    ASSERT_TRUE(poller.add(event));
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0)).empty());
+
+    event.raise();
+    const auto &events = poller.wait(rix::util::Duration(0));
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, event.fd());
+    EXPECT_TRUE(event.is_ready());
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0)).empty());
+}
+
+TEST(EventTest, WaitUntilDeadline) {
+    Event event;
+    rix::util::Time deadline = rix::util::Time::monotonic_now() + rix::util::Duration(0.05);
+    EXPECT_FALSE(event.wait_until(deadline));
+    EXPECT_GE(rix::util::Time::monotonic_now(), deadline);
+
+    // A ready event is consumed even if the deadline has passed
+    EXPECT_TRUE(event.raise());
+    EXPECT_TRUE(event.wait_until(deadline));
+    EXPECT_FALSE(event.wait_until(deadline));
+}
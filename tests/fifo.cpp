@@ -143,3 +143,59 @@ TEST_F(FifoTest, CopyAndMoveAssignment) {
 
     dummy_writer.join();
 }
+
+// Test that a packet-mode fifo returns one write per read
+TEST_F(FifoTest, PacketModePreservesBoundaries) {
+    Fifo reader(fifo_path, Fifo::Mode::READ, true);
+    Fifo writer(fifo_path, Fifo::Mode::WRITE, false, true);
+    ASSERT_TRUE(writer.ok());
+    if (!writer.is_packet_mode()) {
+        GTEST_SKIP() << "Packet mode FIFOs are not supported by this kernel";
+    }
+
+    const std::string a = "abc", b = "defgh";
+    EXPECT_EQ(writer.write(reinterpret_cast<const uint8_t *>(a.data()), a.size()), a.size());
+    EXPECT_EQ(writer.write(reinterpret_cast<const uint8_t *>(b.data()), b.size()), b.size());
+
+    std::vector<uint8_t> buffer(64);
+    EXPECT_EQ(reader.read(buffer.data(), buffer.size()), a.size());
+    EXPECT_EQ(reader.read(buffer.data(), buffer.size()), b.size());
+}
+
+// Test that a persistent reader opens without a writer and never sees EOF
+TEST_F(FifoTest, PersistentReadSurvivesWriterDisconnect) {
+    Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT, true);
+    ASSERT_TRUE(reader.ok());
+    EXPECT_EQ(reader.mode(), Fifo::Mode::READ_PERSISTENT);
+    EXPECT_TRUE(reader.is_nonblocking());
+
+    uint8_t byte = 0;
+    for (uint8_t value = 1; value <= 2; value++) {
+        {
+            Fifo writer(fifo_path, Fifo::Mode::WRITE);
+            ASSERT_TRUE(writer.ok());
+            writer.write(&value, 1);
+        }
+        EXPECT_EQ(reader.read(&byte, 1), 1);
+        EXPECT_EQ(byte, value);
+
+        // The writer has closed, but the internal write end prevents EOF
+        errno = 0;
+        EXPECT_EQ(reader.read(&byte, 1), -1);
+        EXPECT_EQ(errno, EAGAIN);
+    }
+}
+
+// Test that a blocking persistent reader waits for data instead of returning EOF
+TEST_F(FifoTest, PersistentReadBlocksAcrossWriters) {
+    Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT);
+    ASSERT_TRUE(reader.ok());
+    EXPECT_FALSE(reader.is_nonblocking());
+    { Fifo writer(fifo_path, Fifo::Mode::WRITE); }
+    EXPECT_FALSE(reader.wait_for_readable(rix::util::Duration(0.05)));
+
+    Fifo copy(reader);
+    Fifo moved(std::move(reader));
+    EXPECT_TRUE(copy.ok());
+    EXPECT_TRUE(moved.ok());
+}
@@ -0,0 +1,93 @@
+#include "rix/ipc/fifo_monitor.hpp"
+
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "rix/ipc/fifo.hpp"
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+class FifoMonitorTest : public ::testing::Test {
+   protected:
+    std::string fifo_path = "/tmp/test_fifo_monitor";
+
+    void SetUp() override { unlink(fifo_path.c_str()); }
+
+    void TearDown() override { unlink(fifo_path.c_str()); }
+};
+
+TEST_F(FifoMonitorTest, DefaultConstructor) {
+    FifoMonitor monitor;
+    EXPECT_FALSE(monitor.ok());
+    EXPECT_EQ(monitor.fd(), -1);
+    EXPECT_FALSE(monitor.wait(rix::util::Duration(0)));
+}
+
+TEST_F(FifoMonitorTest, MissingFifo) {
+    FifoMonitor monitor(fifo_path);
+    EXPECT_FALSE(monitor.ok());
+}
+
+TEST_F(FifoMonitorTest, ReportsAttachAndDetach) {
+    Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT);
+    FifoMonitor monitor(fifo_path);
+    ASSERT_TRUE(monitor.ok());
+    ASSERT_TRUE(monitor.ignore(reader));
+    EXPECT_EQ(monitor.pathname(), fifo_path);
+
+    // The reader and its internal write end are not reported
+    EXPECT_FALSE(monitor.is_ready());
+    EXPECT_EQ(monitor.event(), FifoMonitor::Event::NONE);
+
+    {
+        Fifo writer(fifo_path, Fifo::Mode::WRITE);
+        EXPECT_TRUE(monitor.is_ready());
+        EXPECT_EQ(monitor.event(), FifoMonitor::Event::ATTACH);
+        EXPECT_EQ(monitor.writers(), 1);
+    }
+    EXPECT_TRUE(monitor.is_ready());
+    EXPECT_EQ(monitor.event(), FifoMonitor::Event::DETACH);
+    EXPECT_EQ(monitor.writers(), 0);
+    EXPECT_FALSE(monitor.is_ready());
+    EXPECT_FALSE(monitor.raise());
+}
+
+TEST_F(FifoMonitorTest, IgnoresReaderClose) {
+    FifoMonitor monitor;
+    {
+        Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT);
+        monitor = FifoMonitor(fifo_path);
+        ASSERT_TRUE(monitor.ignore(reader));
+    }
+
+    // Closing the reader and its internal write end is not a detach
+    EXPECT_FALSE(monitor.is_ready());
+    EXPECT_EQ(monitor.writers(), 0);
+}
+
+TEST_F(FifoMonitorTest, RefusesFifoOpenedAfterMonitor) {
+    ASSERT_EQ(mkfifo(fifo_path.c_str(), 0666), 0);
+    FifoMonitor monitor(fifo_path);
+    ASSERT_TRUE(monitor.ok());
+
+    Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT);
+    EXPECT_FALSE(monitor.ignore(reader));
+}
+
+TEST_F(FifoMonitorTest, RegistersWithPoller) {
+    Fifo reader(fifo_path, Fifo::Mode::READ_PERSISTENT);
+    FifoMonitor monitor(fifo_path);
+    Poller poller;
+    ASSERT_TRUE(poller.add(reader));
+    ASSERT_TRUE(poller.add(monitor));
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0)).empty());
+
+    Fifo writer(fifo_path, Fifo::Mode::WRITE);
+    const auto &events = poller.wait(rix::util::Duration(1.0));
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, monitor.fd());
+    EXPECT_TRUE(monitor.wait(rix::util::Duration(0)));
+    EXPECT_EQ(monitor.event(), FifoMonitor::Event::ATTACH);
+}
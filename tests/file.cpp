@@ -139,3 +139,58 @@ TEST_F(FileTest, WaitForWritable) {
     EXPECT_TRUE(f.wait_for_writable(timeout));
     unlink(writable_file.c_str());
 }
+
+// Test scatter read
+TEST_F(FileTest, ReadvFile) {
+    File f(temp_filename, O_RDONLY);
+    std::vector<uint8_t> first(5), second(7);
+    struct iovec iov[2];
+    iov[0].iov_base = first.data();
+    iov[0].iov_len = first.size();
+    iov[1].iov_base = second.data();
+    iov[1].iov_len = second.size();
+    ASSERT_EQ(f.readv(iov, 2), 12);
+    EXPECT_EQ(std::string(first.begin(), first.end()), "Hello");
+    EXPECT_EQ(std::string(second.begin(), second.end()), ", File!");
+}
+
+// Test gather write
+TEST_F(FileTest, WritevFile) {
+    std::string writable_file = "writev_test.tmp";
+    {
+        File f(writable_file, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+        std::string a = "Writev", b = "Test";
+        struct iovec iov[2];
+        iov[0].iov_base = a.data();
+        iov[0].iov_len = a.size();
+        iov[1].iov_base = b.data();
+        iov[1].iov_len = b.size();
+        EXPECT_EQ(f.writev(iov, 2), a.size() + b.size());
+    }
+
+    std::ifstream in(writable_file);
+    std::string result;
+    in >> result;
+    EXPECT_EQ(result, "WritevTest");
+
+    unlink(writable_file.c_str());
+}
+
+// Test vectored IO on an invalid file
+TEST_F(FileTest, VectoredIOInvalidFile) {
+    File f;
+    uint8_t byte = 0;
+    struct iovec iov[1];
+    iov[0].iov_base = &byte;
+    iov[0].iov_len = 1;
+    EXPECT_EQ(f.readv(iov, 1), -1);
+    EXPECT_EQ(f.writev(iov, 1), -1);
+}
+
+// Test that pipe capacity and queue queries fail on a regular file
+TEST_F(FileTest, CapacityNotAPipe) {
+    File f(temp_filename, O_RDONLY);
+    ASSERT_TRUE(f.ok());
+    EXPECT_EQ(f.capacity(), -1);
+    EXPECT_EQ(f.set_capacity(4096), -1);
+}
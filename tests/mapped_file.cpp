@@ -0,0 +1,108 @@
+#include "rix/ipc/mapped_file.hpp"
+
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "rix/msg/geometry/Twist2DStamped.hpp"
+#include "rix/msg/standard/UInt32.hpp"
+
+using namespace rix::ipc;
+
+class MappedFileTest : public ::testing::Test {
+   protected:
+    std::string temp_filename = "/tmp/test_mapped_file.tmp";
+
+    void SetUp() override { std::ofstream(temp_filename) << "Hello, MappedFile!"; }
+
+    void TearDown() override { unlink(temp_filename.c_str()); }
+};
+
+TEST_F(MappedFileTest, DefaultConstructor) {
+    MappedFile file;
+    EXPECT_FALSE(file.ok());
+    EXPECT_EQ(file.data(), nullptr);
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_TRUE(file.span().empty());
+    EXPECT_FALSE(file.advise(MappedFile::Advice::SEQUENTIAL));
+}
+
+TEST_F(MappedFileTest, MapsWholeFile) {
+    MappedFile file(temp_filename, MappedFile::Advice::SEQUENTIAL);
+    ASSERT_TRUE(file.ok());
+    ASSERT_EQ(file.size(), 18);
+    auto span = file.span();
+    EXPECT_EQ(std::string(span.begin(), span.end()), "Hello, MappedFile!");
+}
+
+TEST_F(MappedFileTest, MissingFileAndDirectory) {
+    EXPECT_FALSE(MappedFile("/tmp/does_not_exist.tmp").ok());
+    EXPECT_FALSE(MappedFile("/tmp").ok());
+}
+
+TEST_F(MappedFileTest, EmptyFile) {
+    std::ofstream(temp_filename, std::ios::trunc);
+    MappedFile file(temp_filename);
+    EXPECT_TRUE(file.ok());
+    EXPECT_EQ(file.size(), 0);
+    EXPECT_TRUE(file.span().empty());
+}
+
+TEST_F(MappedFileTest, Subspans) {
+    MappedFile file(temp_filename);
+    auto span = file.span(7, 6);
+    EXPECT_EQ(std::string(span.begin(), span.end()), "Mapped");
+    EXPECT_EQ(file.span(13, 100).size(), 5);
+    EXPECT_TRUE(file.span(18, 1).empty());
+    EXPECT_TRUE(file.advise(MappedFile::Advice::RANDOM, 7, 6));
+    EXPECT_FALSE(file.advise(MappedFile::Advice::RANDOM, 18));
+}
+
+TEST_F(MappedFileTest, OutlivesFile) {
+    MappedFile mapped;
+    {
+        File file(temp_filename, O_RDONLY);
+        mapped = MappedFile(file, MappedFile::Advice::WILLNEED);
+    }
+    ASSERT_TRUE(mapped.ok());
+    EXPECT_EQ(mapped.data()[0], 'H');
+
+    MappedFile moved(std::move(mapped));
+    EXPECT_FALSE(mapped.ok());
+    EXPECT_TRUE(moved.ok());
+    EXPECT_EQ(moved.size(), 18);
+}
+
+TEST_F(MappedFileTest, DeserializesInPlace) {
+    {
+        File out(temp_filename, O_WRONLY | O_TRUNC);
+        for (uint32_t i = 0; i < 10; i++) {
+            rix::msg::geometry::Twist2DStamped cmd;
+            cmd.header.seq = i;
+            rix::msg::standard::UInt32 length;
+            length.data = cmd.size();
+            std::vector<uint8_t> frame(length.size() + length.data);
+            size_t offset = 0;
+            length.serialize(frame.data(), offset);
+            cmd.serialize(frame.data(), offset);
+            out.write(frame.data(), frame.size());
+        }
+    }
+
+    MappedFile file(temp_filename, MappedFile::Advice::SEQUENTIAL);
+    auto span = file.span();
+    size_t offset = 0;
+    uint32_t count = 0;
+    while (offset < span.size()) {
+        rix::msg::standard::UInt32 length;
+        ASSERT_TRUE(length.deserialize(span.data(), span.size(), offset));
+        rix::msg::geometry::Twist2DStamped cmd;
+        ASSERT_TRUE(cmd.deserialize(span.data(), offset + length.data, offset));
+        EXPECT_EQ(cmd.header.seq, count++);
+    }
+    EXPECT_EQ(count, 10);
+}
@@ -3,9 +3,16 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+
 #include "mocks/mock_io.hpp"
 #include "mocks/mock_mbot.hpp"
 #include "mocks/mock_notification.hpp"
+#include "rix/ipc/event.hpp"
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/shm_ring.hpp"
 
 void twist_equal(const rix::msg::geometry::Twist2D &a, const rix::msg::geometry::Twist2D &b) {
     EXPECT_EQ(a.vx, b.vx);
@@ -13,6 +20,18 @@ void twist_equal(const rix::msg::geometry::Twist2D &a, const rix::msg::geometry:
     EXPECT_EQ(a.wz, b.wz);
 }
 
+static std::vector<uint8_t> make_frame(float vx) {
+    rix::msg::geometry::Twist2DStamped twist;
+    twist.twist.vx = vx;
+    rix::msg::standard::UInt32 size_msg;
+    size_msg.data = twist.size();
+    std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+    size_t offset = 0;
+    size_msg.serialize(buffer.data(), offset);
+    twist.serialize(buffer.data(), offset);
+    return buffer;
+}
+
 TEST(MBotDriverTest, ExitsOnNotification) {
     auto input = std::make_unique<testing::NiceMock<MockIO>>();
     
@@ -120,4 +139,453 @@ TEST(MBotDriverTest, TranslatesDriveCommandsAndExitsOnNotification) {
     twist_equal(mbot_ptr->twists[0].twist, twist1.twist);
     twist_equal(mbot_ptr->twists[1].twist, twist2.twist);
     twist_equal(mbot_ptr->twists[2].twist, {});
-}
\ No newline at end of file
+}
+
+TEST(MBotDriverTest, WakesFromBlockingWaitOnNotification) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+
+    auto notif = std::make_unique<rix::ipc::Signal>(SIGUSR1);
+    auto *notif_ptr = notif.get();
+
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    // The write end stays open, so the driver must be woken by the signal
+    std::thread thr([notif_ptr]() {
+        rix::util::sleep_for(rix::util::Duration(0.1));
+        notif_ptr->raise();
+    });
+    mbot_driver.spin(std::move(notif));
+    thr.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 1);
+    twist_equal(mbot_ptr->twists[0].twist, {});
+}
+
+TEST(MBotDriverTest, ExitsOnNotificationDuringPartialFrame) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+
+    auto notif = std::make_unique<rix::ipc::Signal>(SIGUSR1);
+    auto *notif_ptr = notif.get();
+
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    // The sender stalls halfway through a frame, and only closes its end
+    // long after the signal
+    auto frame = make_frame(1.0f);
+    writer.write(frame.data(), frame.size() / 2);
+    std::atomic<bool> closed(false);
+    std::thread thr([notif_ptr, &writer, &closed]() {
+        rix::util::sleep_for(rix::util::Duration(0.05));
+        notif_ptr->raise();
+        rix::util::sleep_for(rix::util::Duration(0.5));
+        closed = true;
+        writer = rix::ipc::Pipe();
+    });
+    mbot_driver.spin(std::move(notif));
+    EXPECT_FALSE(closed);
+    thr.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 1);
+    twist_equal(mbot_ptr->twists[0].twist, {});
+}
+
+TEST(MBotDriverTest, TranslatesDriveCommandsFromShmRing) {
+    rix::ipc::ShmRing::remove("rix_test_mbot_driver");
+    auto input = std::make_unique<rix::ipc::ShmRing>("rix_test_mbot_driver", rix::ipc::ShmRing::Mode::READ);
+    rix::ipc::ShmRing output("rix_test_mbot_driver", rix::ipc::ShmRing::Mode::WRITE);
+    ASSERT_TRUE(input->ok());
+    ASSERT_TRUE(output.ok());
+
+    rix::msg::geometry::Twist2DStamped twist;
+    twist.header.frame_id = "mbot";
+    twist.twist.vx = 1.0f;
+    rix::msg::standard::UInt32 size_msg;
+    size_msg.data = twist.size();
+    std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+    size_t offset = 0;
+    size_msg.serialize(buffer.data(), offset);
+    twist.serialize(buffer.data(), offset);
+    output.write(buffer.data(), buffer.size());
+    output = rix::ipc::ShmRing();
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+    mbot_driver.spin(std::make_unique<testing::NiceMock<MockNotification>>());
+    rix::ipc::ShmRing::remove("rix_test_mbot_driver");
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 2);
+    twist_equal(mbot_ptr->twists[0].twist, twist.twist);
+    twist_equal(mbot_ptr->twists[1].twist, {});
+}
+
+TEST(MBotDriverTest, ServesSeveralSocketClients) {
+    const std::string path = "/tmp/rix_test_mbot_driver_socket";
+    rix::ipc::UnixListener listener(path);
+    ASSERT_TRUE(listener.ok());
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::make_unique<testing::NiceMock<MockIO>>(), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    std::thread server([&]() { mbot_driver.serve(listener, std::move(notif)); });
+
+    auto send = [](const rix::ipc::UnixSocket &client, float vx) {
+        rix::msg::geometry::Twist2DStamped twist;
+        twist.twist.vx = vx;
+        rix::msg::standard::UInt32 size_msg;
+        size_msg.data = twist.size();
+        std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+        size_t offset = 0;
+        size_msg.serialize(buffer.data(), offset);
+        twist.serialize(buffer.data(), offset);
+        client.write(buffer.data(), buffer.size());
+    };
+
+    {
+        rix::ipc::UnixSocket client1(path), client2(path);
+        ASSERT_TRUE(client1.ok());
+        ASSERT_TRUE(client2.ok());
+        send(client1, 1.0f);
+        send(client2, 2.0f);
+        send(client1, 3.0f);
+
+        // A malformed command is ignored
+        uint8_t garbage[3] = {1, 2, 3};
+        client2.write(garbage, sizeof(garbage));
+        rix::util::sleep_for(rix::util::Duration(0.1));
+    }
+
+    // Both clients have disconnected, which stops the robot
+    rix::util::sleep_for(rix::util::Duration(0.1));
+    notif_ptr->raise();
+    server.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 5);
+    float sum = 0.0f;
+    for (size_t i = 0; i < 3; i++) {
+        sum += mbot_ptr->twists[i].twist.vx;
+    }
+    EXPECT_EQ(sum, 6.0f);
+    twist_equal(mbot_ptr->twists[3].twist, {});
+    twist_equal(mbot_ptr->twists[4].twist, {});
+}
+
+TEST(MBotDriverTest, ServesUdpAndDropsStaleCommands) {
+    rix::ipc::UdpSocket socket("127.0.0.1", 0);
+    ASSERT_TRUE(socket.ok());
+    rix::ipc::UdpSocket sender("127.0.0.1", 0);
+    ASSERT_TRUE(sender.connect("127.0.0.1", socket.port()));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::make_unique<testing::NiceMock<MockIO>>(), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    size_t dropped = 0;
+    std::thread server([&]() { dropped = mbot_driver.serve(socket, std::move(notif)); });
+
+    std::vector<std::vector<uint8_t>> datagrams;
+    for (uint32_t seq : {1, 2, 4, 3, 5}) {
+        rix::msg::geometry::Twist2DStamped twist;
+        twist.header.seq = seq;
+        twist.twist.vx = static_cast<float>(seq);
+        rix::msg::standard::UInt32 size_msg;
+        size_msg.data = twist.size();
+        std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+        size_t offset = 0;
+        size_msg.serialize(buffer.data(), offset);
+        twist.serialize(buffer.data(), offset);
+        datagrams.push_back(buffer);
+    }
+    ASSERT_EQ(sender.send_batch(datagrams), 5);
+
+    rix::util::sleep_for(rix::util::Duration(0.1));
+    notif_ptr->raise();
+    server.join();
+
+    EXPECT_EQ(dropped, 1);
+    ASSERT_EQ(mbot_ptr->twists.size(), 5);
+    EXPECT_EQ(mbot_ptr->twists[0].header.seq, 1);
+    EXPECT_EQ(mbot_ptr->twists[1].header.seq, 2);
+    EXPECT_EQ(mbot_ptr->twists[2].header.seq, 4);
+    EXPECT_EQ(mbot_ptr->twists[3].header.seq, 5);
+    twist_equal(mbot_ptr->twists[4].twist, {});
+}
+
+TEST(MBotDriverTest, ServesUdpFromRestartedSender) {
+    rix::ipc::UdpSocket socket("127.0.0.1", 0);
+    ASSERT_TRUE(socket.ok());
+    rix::ipc::UdpSocket sender("127.0.0.1", 0);
+    ASSERT_TRUE(sender.connect("127.0.0.1", socket.port()));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::make_unique<testing::NiceMock<MockIO>>(), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    size_t dropped = 0;
+    std::thread server([&]() { dropped = mbot_driver.serve(socket, std::move(notif)); });
+
+    // The first session reaches seq 3, then the sender restarts at 0 and
+    // sends a stop command, which is duplicated
+    std::vector<std::vector<uint8_t>> datagrams;
+    std::vector<std::pair<uint32_t, int32_t>> commands = {{1, 1}, {2, 2}, {3, 3}, {0, 10}, {0, 10}};
+    for (auto [seq, sec] : commands) {
+        rix::msg::geometry::Twist2DStamped twist;
+        twist.header.seq = seq;
+        twist.header.stamp.sec = sec;
+        twist.twist.vx = seq == 0 ? 0.0f : 1.0f;
+        rix::msg::standard::UInt32 size_msg;
+        size_msg.data = twist.size();
+        std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+        size_t offset = 0;
+        size_msg.serialize(buffer.data(), offset);
+        twist.serialize(buffer.data(), offset);
+        datagrams.push_back(buffer);
+    }
+    ASSERT_EQ(sender.send_batch(datagrams), 5);
+
+    rix::util::sleep_for(rix::util::Duration(0.1));
+    notif_ptr->raise();
+    server.join();
+
+    EXPECT_EQ(dropped, 1);
+    ASSERT_EQ(mbot_ptr->twists.size(), 5);
+    EXPECT_EQ(mbot_ptr->twists[2].header.seq, 3);
+    EXPECT_EQ(mbot_ptr->twists[3].header.seq, 0);
+    EXPECT_EQ(mbot_ptr->twists[3].header.stamp.sec, 10);
+    twist_equal(mbot_ptr->twists[3].twist, {});
+}
+
+TEST(MBotDriverTest, CycledSpinAppliesNewestCommandPerDeadline) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    // A burst queued before the first deadline is applied as one command
+    for (float vx : {1.0f, 2.0f, 3.0f}) {
+        auto frame = make_frame(vx);
+        writer.write(frame.data(), frame.size());
+    }
+
+    const rix::util::Duration cycle(0.05);
+    std::thread sender([&writer, cycle]() {
+        rix::util::sleep_for(cycle * 2);
+        auto frame = make_frame(4.0f);
+        writer.write(frame.data(), frame.size());
+        rix::util::sleep_for(cycle * 2);
+        writer = rix::ipc::Pipe();
+    });
+
+    rix::util::Time start = rix::util::Time::now();
+    mbot_driver.spin(std::make_unique<testing::NiceMock<MockNotification>>(), cycle);
+    rix::util::Duration elapsed = rix::util::Time::now() - start;
+    sender.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 3);
+    EXPECT_EQ(mbot_ptr->twists[0].twist.vx, 3.0f);
+    EXPECT_EQ(mbot_ptr->twists[1].twist.vx, 4.0f);
+    twist_equal(mbot_ptr->twists[2].twist, {});
+    EXPECT_EQ(mbot_driver.overruns(), 0);
+    EXPECT_GE(elapsed, cycle * 4);
+}
+
+TEST(MBotDriverTest, CycledSpinKeepsDeadlineDuringPartialFrame) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    // A whole frame, then later half of the next one, which never completes
+    auto frame = make_frame(1.0f);
+    writer.write(frame.data(), frame.size());
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    std::atomic<bool> closed(false);
+    std::thread stopper([notif_ptr, &writer, &closed]() {
+        rix::util::sleep_for(rix::util::Duration(0.02));
+        auto partial = make_frame(2.0f);
+        writer.write(partial.data(), partial.size() / 2);
+        rix::util::sleep_for(rix::util::Duration(0.1));
+        notif_ptr->raise();
+        rix::util::sleep_for(rix::util::Duration(0.5));
+        closed = true;
+        writer = rix::ipc::Pipe();
+    });
+
+    mbot_driver.spin(std::move(notif), rix::util::Duration(0.05));
+    EXPECT_FALSE(closed);
+    stopper.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 2);
+    EXPECT_EQ(mbot_ptr->twists[0].twist.vx, 1.0f);
+    twist_equal(mbot_ptr->twists[1].twist, {});
+    EXPECT_EQ(mbot_driver.overruns(), 0);
+}
+
+TEST(MBotDriverTest, CycledSpinExitsOnNotification) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    std::thread stopper([notif_ptr]() {
+        rix::util::sleep_for(rix::util::Duration(0.12));
+        notif_ptr->raise();
+    });
+
+    mbot_driver.spin(std::move(notif), rix::util::Duration(0.05));
+    stopper.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 1);
+    twist_equal(mbot_ptr->twists[0].twist, {});
+}
+
+TEST(MBotDriverTest, CycledSpinDrivesWhileInputNeverPauses) {
+    // Every read returns the next frame, so input is always available
+    auto input = std::make_unique<testing::NiceMock<MockIO>>();
+    float vx = 0.0f;
+    ON_CALL(*input, read).WillByDefault([&vx](uint8_t *dst, size_t len) -> ssize_t {
+        vx += 1.0f;
+        auto frame = make_frame(vx);
+        len = std::min(len, frame.size());
+        std::memcpy(dst, frame.data(), len);
+        return len;
+    });
+    ON_CALL(*input, wait_for_readable).WillByDefault(testing::Return(true));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    std::thread stopper([notif_ptr]() {
+        rix::util::sleep_for(rix::util::Duration(0.22));
+        notif_ptr->raise();
+    });
+
+    mbot_driver.spin(std::move(notif), rix::util::Duration(0.05));
+    stopper.join();
+
+    ASSERT_GE(mbot_ptr->twists.size(), 4);
+    for (size_t i = 1; i + 1 < mbot_ptr->twists.size(); i++) {
+        EXPECT_GT(mbot_ptr->twists[i].twist.vx, mbot_ptr->twists[i - 1].twist.vx);
+    }
+    twist_equal(mbot_ptr->twists.back().twist, {});
+}
+
+TEST(MBotDriverTest, AsyncSpinTranslatesDriveCommandsAndExitsOnEOF) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    std::thread producer([&writer]() {
+        for (int i = 1; i <= 3; i++) {
+            rix::msg::geometry::Twist2DStamped twist;
+            twist.twist.vx = i;
+            rix::msg::standard::UInt32 size_msg;
+            size_msg.data = twist.size();
+            std::vector<uint8_t> buffer(size_msg.size() + size_msg.data);
+            size_t offset = 0;
+            size_msg.serialize(buffer.data(), offset);
+            twist.serialize(buffer.data(), offset);
+            writer.write(buffer.data(), buffer.size());
+            rix::util::sleep_for(rix::util::Duration(0.01));
+        }
+        writer = rix::ipc::Pipe();
+    });
+
+    mbot_driver.spin_async(std::make_unique<rix::ipc::Event>());
+    producer.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 4);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(mbot_ptr->twists[i].twist.vx, i + 1);
+    }
+    twist_equal(mbot_ptr->twists[3].twist, {});
+}
+
+TEST(MBotDriverTest, AsyncSpinSkipsOversizedFrame) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    // The payload of the oversized frame would read as more oversized length
+    // prefixes if it were parsed
+    std::thread producer([&writer]() {
+        rix::msg::standard::UInt32 size_msg;
+        size_msg.data = 100000;
+        std::vector<uint8_t> buffer(size_msg.size() + size_msg.data, 0x10);
+        size_t offset = 0;
+        size_msg.serialize(buffer.data(), offset);
+        for (size_t sent = 0; sent < buffer.size();) {
+            ssize_t n = writer.write(buffer.data() + sent, buffer.size() - sent);
+            if (n <= 0) {
+                return;
+            }
+            sent += n;
+        }
+        auto frame = make_frame(5.0f);
+        writer.write(frame.data(), frame.size());
+        writer = rix::ipc::Pipe();
+    });
+
+    mbot_driver.spin_async(std::make_unique<rix::ipc::Event>());
+    producer.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 2);
+    EXPECT_EQ(mbot_ptr->twists[0].twist.vx, 5.0f);
+    twist_equal(mbot_ptr->twists[1].twist, {});
+}
+
+TEST(MBotDriverTest, AsyncSpinExitsOnNotification) {
+    auto [reader, writer] = rix::ipc::Pipe::create();
+    auto input = std::make_unique<rix::ipc::Pipe>(std::move(reader));
+
+    auto mbot = std::make_unique<testing::NiceMock<MockMBot>>();
+    auto *mbot_ptr = mbot.get(); // Need to get raw pointer for inspection
+    MBotDriver mbot_driver(std::move(input), std::move(mbot));
+
+    auto notif = std::make_unique<rix::ipc::Event>();
+    auto *notif_ptr = notif.get();
+    std::thread stopper([notif_ptr]() {
+        rix::util::sleep_for(rix::util::Duration(0.05));
+        notif_ptr->raise();
+    });
+
+    mbot_driver.spin_async(std::move(notif));
+    stopper.join();
+
+    ASSERT_EQ(mbot_ptr->twists.size(), 1);
+    twist_equal(mbot_ptr->twists[0].twist, {});
+}
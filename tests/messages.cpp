@@ -1,3 +1,4 @@
+#include "rix/msg/standard/Duration.hpp"
 #include "rix/msg/standard/Time.hpp"
 #include "rix/msg/standard/Header.hpp"
 #include "rix/msg/standard/UInt32.hpp"
@@ -141,4 +142,76 @@ TEST(Messages, GeometryTwist2DStampedTest) {
     EXPECT_NEAR(tws2.twist.vx, tws1.twist.vx, 1e-6);
     EXPECT_NEAR(tws2.twist.vy, tws1.twist.vy, 1e-6);
     EXPECT_NEAR(tws2.twist.wz, tws1.twist.wz, 1e-6);
-}
\ No newline at end of file
+}
+
+TEST(Messages, StaticSizeTest) {
+    static_assert(rix::msg::static_size_v<UInt32> == 4);
+    static_assert(rix::msg::static_size_v<Time> == 8);
+    static_assert(rix::msg::static_size_v<Duration> == 8);
+    static_assert(rix::msg::static_size_v<Twist2D> == 12);
+    static_assert(!rix::msg::has_static_size_v<Header>);
+    static_assert(!rix::msg::has_static_size_v<Twist2DStamped>);
+
+    EXPECT_EQ(UInt32().size(), rix::msg::static_size_v<UInt32>);
+    EXPECT_EQ(Time().size(), rix::msg::static_size_v<Time>);
+    EXPECT_EQ(Duration().size(), rix::msg::static_size_v<Duration>);
+    EXPECT_EQ(Twist2D().size(), rix::msg::static_size_v<Twist2D>);
+}
+
+TEST(Messages, Twist2DStampedViewTest) {
+    Twist2DStamped tws;
+    tws.header.frame_id = "mbot";
+    tws.header.seq = 123;
+    tws.header.stamp.sec = 456;
+    tws.header.stamp.nsec = 789;
+    tws.twist.vx = 1.23;
+    tws.twist.vy = 4.56;
+    tws.twist.wz = 7.89;
+
+    std::vector<uint8_t> buffer(tws.size());
+    size_t offset = 0;
+    tws.serialize(buffer.data(), offset);
+
+    Twist2DStampedView view;
+    offset = 0;
+    ASSERT_TRUE(view.wrap(buffer.data(), buffer.size(), offset));
+    ASSERT_EQ(offset, buffer.size()) << "Twist2DStampedView::wrap offset is incorrect.";
+
+    EXPECT_EQ(view.header().seq(), tws.header.seq);
+    EXPECT_EQ(view.header().stamp().sec(), tws.header.stamp.sec);
+    EXPECT_EQ(view.header().stamp().nsec(), tws.header.stamp.nsec);
+    EXPECT_EQ(view.header().frame_id(), tws.header.frame_id);
+    EXPECT_EQ(view.twist().vx(), tws.twist.vx);
+    EXPECT_EQ(view.twist().vy(), tws.twist.vy);
+    EXPECT_EQ(view.twist().wz(), tws.twist.wz);
+
+    // The frame id points into the buffer rather than at a copy
+    const char *begin = reinterpret_cast<const char *>(buffer.data());
+    EXPECT_GE(view.header().frame_id().data(), begin);
+    EXPECT_LT(view.header().frame_id().data(), begin + buffer.size());
+}
+
+TEST(Messages, Twist2DStampedViewTruncatedTest) {
+    Twist2DStamped tws;
+    tws.header.frame_id = "mbot";
+    std::vector<uint8_t> buffer(tws.size());
+    size_t offset = 0;
+    tws.serialize(buffer.data(), offset);
+
+    // Every strict prefix of the message is rejected
+    for (size_t size = 0; size < buffer.size(); size++) {
+        Twist2DStampedView view;
+        offset = 0;
+        EXPECT_FALSE(view.wrap(buffer.data(), size, offset)) << "Twist2DStampedView accepted " << size << " bytes.";
+    }
+}
+
+TEST(Messages, HashesMatchPublishedValues) {
+    using Hash = std::array<uint64_t, 2>;
+    EXPECT_EQ(Twist2D().hash(), Hash({0x5b9303e27c7b02c0ULL, 0x761ea21c80ce8d68ULL}));
+    EXPECT_EQ(Twist2DStamped().hash(), Hash({0x463cb851594cfdbeULL, 0x9be7d269b40e97b6ULL}));
+    EXPECT_EQ(Duration().hash(), Hash({0x3cfabdd6930400b6ULL, 0x2301ecce2a9d00f6ULL}));
+    EXPECT_EQ(Header().hash(), Hash({0x5c6e963f7b8b9afeULL, 0x9b53bcf470f873c6ULL}));
+    EXPECT_EQ(Time().hash(), Hash({0xe80974cc496bf99dULL, 0xf7f4f2296e012a33ULL}));
+    EXPECT_EQ(UInt32().hash(), Hash({0x55aa2bc284c5d8d8ULL, 0x59a88852ffabad79ULL}));
+}
@@ -40,6 +40,30 @@ class MockIO : public rix::ipc::interfaces::IO {
             cv.notify_all();
             return len;
         });
+        ON_CALL(*this, readv).WillByDefault([this](const struct iovec *iov, int iovcnt) -> ssize_t {
+            // Simulate a scatter read as a single read followed by a copy into each destination buffer
+            size_t total = 0;
+            for (int i = 0; i < iovcnt; i++) total += iov[i].iov_len;
+            std::vector<uint8_t> tmp(total);
+            ssize_t n = this->read(tmp.data(), tmp.size());
+            if (n <= 0) return n;
+            size_t offset = 0;
+            for (int i = 0; i < iovcnt && offset < static_cast<size_t>(n); i++) {
+                size_t len = std::min(iov[i].iov_len, static_cast<size_t>(n) - offset);
+                std::memcpy(iov[i].iov_base, tmp.data() + offset, len);
+                offset += len;
+            }
+            return n;
+        });
+        ON_CALL(*this, writev).WillByDefault([this](const struct iovec *iov, int iovcnt) -> ssize_t {
+            // Simulate a gather write as a single atomic write of the concatenated buffers
+            std::vector<uint8_t> tmp;
+            for (int i = 0; i < iovcnt; i++) {
+                const uint8_t *base = static_cast<const uint8_t *>(iov[i].iov_base);
+                tmp.insert(tmp.end(), base, base + iov[i].iov_len);
+            }
+            return this->write(tmp.data(), tmp.size());
+        });
         ON_CALL(*this, wait_for_writable).WillByDefault([this](const rix::util::Duration &d) -> bool {
             return read_end_open;
         });
@@ -56,6 +80,8 @@ class MockIO : public rix::ipc::interfaces::IO {
 
     MOCK_METHOD(ssize_t, read, (uint8_t *buffer, size_t len), (const, override));
     MOCK_METHOD(ssize_t, write, (const uint8_t *buffer, size_t len), (const, override));
+    MOCK_METHOD(ssize_t, readv, (const struct iovec *iov, int iovcnt), (const, override));
+    MOCK_METHOD(ssize_t, writev, (const struct iovec *iov, int iovcnt), (const, override));
     MOCK_METHOD(bool, wait_for_writable, (const rix::util::Duration &duration), (const, override));
     MOCK_METHOD(bool, wait_for_readable, (const rix::util::Duration &duration), (const, override));
     MOCK_METHOD(void, set_nonblocking, (bool status), (override));
@@ -0,0 +1,91 @@
+#include "rix/ipc/packet.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rix/ipc/buffered_reader.hpp"
+#include "rix/ipc/pipe.hpp"
+
+using namespace rix::ipc;
+
+static std::vector<uint8_t> bytes(const std::string &s) { return std::vector<uint8_t>(s.begin(), s.end()); }
+
+TEST(PacketTest, RoundTrip) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketWriter out(writer);
+    PacketReader in(reader);
+
+    auto a = bytes("first"), b = bytes("second frame");
+    EXPECT_EQ(out.write_frame(a.data(), a.size()), PacketWriter::PREFIX_SIZE + a.size());
+    EXPECT_EQ(out.write_frame(b.data(), b.size()), PacketWriter::PREFIX_SIZE + b.size());
+
+    std::vector<uint8_t> frame;
+    EXPECT_EQ(in.read_frame(frame), PacketWriter::PREFIX_SIZE + a.size());
+    EXPECT_EQ(frame, a);
+    EXPECT_EQ(in.read_frame(frame), PacketWriter::PREFIX_SIZE + b.size());
+    EXPECT_EQ(frame, b);
+}
+
+TEST(PacketTest, EmptyPayload) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketWriter out(writer);
+    PacketReader in(reader);
+
+    EXPECT_EQ(out.write_frame(nullptr, 0), PacketWriter::PREFIX_SIZE);
+    std::vector<uint8_t> frame(3);
+    EXPECT_EQ(in.read_frame(frame), PacketWriter::PREFIX_SIZE);
+    EXPECT_TRUE(frame.empty());
+}
+
+TEST(PacketTest, RejectsOversizedFrame) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketWriter out(writer);
+
+    std::vector<uint8_t> payload(PacketWriter::MAX_FRAME_SIZE);
+    errno = 0;
+    EXPECT_EQ(out.write_frame(payload.data(), payload.size()), -1);
+    EXPECT_EQ(errno, EMSGSIZE);
+    EXPECT_EQ(out.write_frame(payload.data(), PacketWriter::MAX_FRAME_SIZE - PacketWriter::PREFIX_SIZE),
+              PacketWriter::MAX_FRAME_SIZE);
+}
+
+TEST(PacketTest, RejectsMismatchedPrefix) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketReader in(reader);
+
+    // A packet whose prefix announces more bytes than it carries
+    uint8_t packet[6] = {10, 0, 0, 0, 1, 2};
+    writer.write(packet, sizeof(packet));
+
+    std::vector<uint8_t> frame;
+    errno = 0;
+    EXPECT_EQ(in.read_frame(frame), -1);
+    EXPECT_EQ(errno, EBADMSG);
+}
+
+TEST(PacketTest, ReadReturnsZeroOnEOF) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketReader in(reader);
+    writer = Pipe();
+
+    std::vector<uint8_t> frame;
+    EXPECT_EQ(in.read_frame(frame), 0);
+}
+
+TEST(PacketTest, BufferedReaderReadsPackets) {
+    auto [reader, writer] = Pipe::create(true);
+    PacketWriter out(writer);
+    BufferedReader in(reader);
+
+    auto a = bytes("first"), b = bytes("second");
+    out.write_frame(a.data(), a.size());
+    out.write_frame(b.data(), b.size());
+
+    std::vector<uint8_t> frame;
+    EXPECT_EQ(in.read_frame(frame), PacketWriter::PREFIX_SIZE + a.size());
+    EXPECT_EQ(frame, a);
+    EXPECT_EQ(in.read_frame(frame), PacketWriter::PREFIX_SIZE + b.size());
+    EXPECT_EQ(frame, b);
+}
@@ -110,3 +110,86 @@ TEST(PipeTest, ReadEndCannotWrite) {
     ssize_t result = reader.write(reinterpret_cast<const uint8_t*>(msg.data()), msg.size());
     EXPECT_EQ(result, -1);  // Should fail
 }
+
+// Test that a gather write is received as one contiguous stream and can be scattered on read
+TEST(PipeTest, WritevReadvRoundTrip) {
+    auto [reader, writer] = Pipe::create();
+
+    uint32_t prefix = 4;
+    const std::string body = "body";
+    struct iovec out[2];
+    out[0].iov_base = &prefix;
+    out[0].iov_len = sizeof(prefix);
+    out[1].iov_base = const_cast<char *>(body.data());
+    out[1].iov_len = body.size();
+    EXPECT_EQ(writer.writev(out, 2), sizeof(prefix) + body.size());
+
+    uint32_t prefix_in = 0;
+    std::vector<uint8_t> body_in(body.size());
+    struct iovec in[2];
+    in[0].iov_base = &prefix_in;
+    in[0].iov_len = sizeof(prefix_in);
+    in[1].iov_base = body_in.data();
+    in[1].iov_len = body_in.size();
+    EXPECT_EQ(reader.readv(in, 2), sizeof(prefix) + body.size());
+    EXPECT_EQ(prefix_in, prefix);
+    EXPECT_EQ(std::string(body_in.begin(), body_in.end()), body);
+}
+
+// Test that a packet-mode pipe returns one write per read
+TEST(PipeTest, PacketModePreservesBoundaries) {
+    auto [reader, writer] = Pipe::create(true);
+    ASSERT_TRUE(reader.ok());
+    EXPECT_TRUE(writer.is_packet_mode());
+
+    const std::string a = "abc", b = "defgh";
+    EXPECT_EQ(writer.write(reinterpret_cast<const uint8_t *>(a.data()), a.size()), a.size());
+    EXPECT_EQ(writer.write(reinterpret_cast<const uint8_t *>(b.data()), b.size()), b.size());
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(reader.read(buffer.data(), buffer.size()), a.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + a.size()), a);
+    ASSERT_EQ(reader.read(buffer.data(), buffer.size()), b.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + b.size()), b);
+
+    auto [stream_reader, stream_writer] = Pipe::create();
+    EXPECT_FALSE(stream_writer.is_packet_mode());
+}
+
+// Test that the pipe capacity can be read and shrunk, and the queued bytes counted
+TEST(PipeTest, CapacityAndQueuedBytes) {
+    auto [reader, writer] = Pipe::create();
+    EXPECT_GT(writer.capacity(), 0);
+    EXPECT_EQ(reader.capacity(), writer.capacity());
+
+    long page = sysconf(_SC_PAGESIZE);
+    EXPECT_EQ(writer.set_capacity(1), page);
+    EXPECT_EQ(reader.capacity(), page);
+
+    EXPECT_EQ(reader.bytes_queued(), 0);
+    std::vector<uint8_t> data(100, 1);
+    writer.write(data.data(), data.size());
+    EXPECT_EQ(reader.bytes_queued(), 100);
+    reader.read(data.data(), 40);
+    EXPECT_EQ(reader.bytes_queued(), 60);
+
+    EXPECT_EQ(Pipe().capacity(), -1);
+    EXPECT_EQ(Pipe().bytes_queued(), -1);
+}
+
+TEST(PipeTest, WaitUntilDeadline) {
+    auto [reader, writer] = Pipe::create();
+
+    // A deadline in the past only checks
+    EXPECT_FALSE(reader.wait_until_readable(rix::util::Time::monotonic_now() - rix::util::Duration(1.0)));
+    EXPECT_TRUE(writer.wait_until_writable(rix::util::Time::monotonic_now() - rix::util::Duration(1.0)));
+
+    rix::util::Time deadline = rix::util::Time::monotonic_now() + rix::util::Duration(0.05);
+    EXPECT_FALSE(reader.wait_until_readable(deadline));
+    EXPECT_GE(rix::util::Time::monotonic_now(), deadline);
+    EXPECT_LT(rix::util::Time::monotonic_now(), deadline + rix::util::Duration(0.025));
+
+    uint8_t byte = 1;
+    writer.write(&byte, 1);
+    EXPECT_TRUE(reader.wait_until_readable(rix::util::Time::max()));
+}
@@ -0,0 +1,157 @@
+#include "rix/ipc/poller.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/signal.hpp"
+
+using namespace rix::ipc;
+
+TEST(PollerTest, Constructor) {
+    Poller poller;
+    EXPECT_TRUE(poller.ok());
+    EXPECT_EQ(poller.size(), 0);
+}
+
+TEST(PollerTest, MoveConstructor) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader));
+
+    Poller moved(std::move(poller));
+    EXPECT_FALSE(poller.ok());
+    EXPECT_TRUE(moved.ok());
+    EXPECT_EQ(moved.size(), 1);
+}
+
+TEST(PollerTest, AddRejectsInvalid) {
+    Poller poller;
+    Pipe invalid;
+    EXPECT_FALSE(poller.add(invalid));
+
+    auto [reader, writer] = Pipe::create();
+    EXPECT_TRUE(poller.add(reader));
+    EXPECT_FALSE(poller.add(reader)) << "Duplicate registration should fail";
+    EXPECT_EQ(poller.size(), 1);
+}
+
+TEST(PollerTest, TimeoutReturnsEmptySet) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader));
+
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0.1)).empty());
+    timer.stop();
+    EXPECT_NEAR(timer.get().to_milliseconds(), 100, 50);
+}
+
+TEST(PollerTest, ReportsReadyObjects) {
+    Poller poller;
+    auto [reader1, writer1] = Pipe::create();
+    auto [reader2, writer2] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader1));
+    ASSERT_TRUE(poller.add(reader2));
+    ASSERT_TRUE(poller.add(writer1, Poller::WRITABLE));
+
+    uint8_t byte = 1;
+    writer2.write(&byte, 1);
+
+    auto &ready = poller.wait(rix::util::Duration(0.0));
+    ASSERT_EQ(ready.size(), 2);
+    for (const auto &event : ready) {
+        if (event.fd == reader2.fd()) {
+            EXPECT_TRUE(event.readable());
+        } else {
+            EXPECT_EQ(event.fd, writer1.fd());
+            EXPECT_TRUE(event.writable());
+        }
+    }
+}
+
+TEST(PollerTest, LevelTriggeredRepeats) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader, Poller::READABLE, Poller::Trigger::LEVEL));
+
+    uint8_t byte = 1;
+    writer.write(&byte, 1);
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 1);
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 1);
+}
+
+TEST(PollerTest, EdgeTriggeredReportsOnce) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader, Poller::READABLE, Poller::Trigger::EDGE));
+
+    uint8_t byte = 1;
+    writer.write(&byte, 1);
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 1);
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 0);
+    writer.write(&byte, 1);
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 1);
+}
+
+TEST(PollerTest, ModifyAndRemove) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(writer, Poller::READABLE));
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0.0)).empty());
+
+    ASSERT_TRUE(poller.modify(writer.fd(), Poller::WRITABLE));
+    EXPECT_EQ(poller.wait(rix::util::Duration(0.0)).size(), 1);
+
+    ASSERT_TRUE(poller.remove(writer));
+    EXPECT_EQ(poller.size(), 0);
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0.0)).empty());
+    EXPECT_FALSE(poller.remove(writer));
+}
+
+TEST(PollerTest, ReportsHangup) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader));
+    writer = Pipe();
+
+    auto &ready = poller.wait(rix::util::Duration(0.0));
+    ASSERT_EQ(ready.size(), 1);
+    EXPECT_TRUE(ready[0].hangup());
+}
+
+TEST(PollerTest, WakesOnSignal) {
+    Poller poller;
+    Signal sig(SIGUSR1);
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(sig));
+    ASSERT_TRUE(poller.add(reader));
+
+    std::thread thr([&sig]() {
+        rix::util::sleep_for(rix::util::Duration(0.1));
+        sig.raise();
+    });
+
+    auto &ready = poller.wait(rix::util::Duration(5.0));
+    thr.join();
+    ASSERT_EQ(ready.size(), 1);
+    EXPECT_EQ(ready[0].fd, sig.fd());
+    EXPECT_TRUE(sig.is_ready());
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0.0)).empty());
+}
+
+TEST(PollerTest, WaitUntilDeadline) {
+    Poller poller;
+    auto [reader, writer] = Pipe::create();
+    ASSERT_TRUE(poller.add(reader));
+
+    rix::util::Time deadline = rix::util::Time::monotonic_now() + rix::util::Duration(0.05);
+    EXPECT_TRUE(poller.wait_until(deadline).empty());
+    EXPECT_GE(rix::util::Time::monotonic_now(), deadline);
+
+    uint8_t byte = 1;
+    writer.write(&byte, 1);
+    EXPECT_EQ(poller.wait_until(deadline).size(), 1);
+}
@@ -0,0 +1,78 @@
+#include "rix/ipc/queue_sampler.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+TEST(QueueSamplerTest, TracksHighWaterMark) {
+    auto [reader, writer] = Pipe::create();
+    QueueSampler sampler(reader, rix::util::Duration(0.01));
+    ASSERT_TRUE(sampler.ok());
+    EXPECT_EQ(sampler.threshold(), 0);
+
+    ASSERT_TRUE(sampler.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(sampler.last(), 0);
+
+    std::vector<uint8_t> data(300, 1);
+    writer.write(data.data(), data.size());
+    ASSERT_TRUE(sampler.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(sampler.last(), 300);
+
+    reader.read(data.data(), 200);
+    ASSERT_TRUE(sampler.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(sampler.last(), 100);
+    EXPECT_EQ(sampler.high_water_mark(), 300);
+    EXPECT_GE(sampler.samples(), 3);
+
+    sampler.reset();
+    EXPECT_EQ(sampler.high_water_mark(), 0);
+    EXPECT_EQ(sampler.samples(), 0);
+}
+
+TEST(QueueSamplerTest, ReportsOnlyBacklog) {
+    auto [reader, writer] = Pipe::create();
+    QueueSampler sampler(reader, rix::util::Duration(0.01), 1000);
+
+    // Samples below the threshold are taken but not reported
+    EXPECT_FALSE(sampler.wait(rix::util::Duration(0.05)));
+    EXPECT_GE(sampler.samples(), 2);
+
+    std::vector<uint8_t> data(1000, 1);
+    writer.write(data.data(), data.size());
+    EXPECT_TRUE(sampler.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(sampler.last(), 1000);
+}
+
+TEST(QueueSamplerTest, RaiseSamplesImmediately) {
+    auto [reader, writer] = Pipe::create();
+    QueueSampler sampler(reader, rix::util::Duration(10.0));
+    EXPECT_FALSE(sampler.is_ready());
+    EXPECT_TRUE(sampler.raise());
+    EXPECT_TRUE(sampler.is_ready());
+    EXPECT_EQ(sampler.samples(), 1);
+}
+
+TEST(QueueSamplerTest, InvalidPeriod) {
+    auto [reader, writer] = Pipe::create();
+    QueueSampler sampler(reader, rix::util::Duration(0.0));
+    EXPECT_FALSE(sampler.ok());
+    EXPECT_EQ(sampler.fd(), -1);
+    EXPECT_FALSE(sampler.wait(rix::util::Duration(0)));
+}
+
+TEST(QueueSamplerTest, RegistersWithPoller) {
+    auto [reader, writer] = Pipe::create();
+    QueueSampler sampler(reader, rix::util::Duration(0.02));
+    Poller poller;
+    ASSERT_TRUE(poller.add(sampler));
+
+    const auto &events = poller.wait(rix::util::Duration(1.0));
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, sampler.fd());
+    EXPECT_TRUE(sampler.is_ready());
+}
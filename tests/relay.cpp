@@ -0,0 +1,172 @@
+#include "rix/ipc/relay.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rix::ipc;
+
+class RelayTest : public ::testing::Test {
+   protected:
+    std::string record_filename = "/tmp/test_relay_record.tmp";
+
+    void TearDown() override { unlink(record_filename.c_str()); }
+
+    std::string read_record() {
+        std::ifstream in(record_filename, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+};
+
+TEST_F(RelayTest, DefaultConstructor) {
+    Relay relay;
+    EXPECT_FALSE(relay.ok());
+    EXPECT_FALSE(relay.is_recording());
+    EXPECT_EQ(relay.forward(), -1);
+    EXPECT_EQ(relay.record(), -1);
+}
+
+TEST_F(RelayTest, SpliceAndTee) {
+    auto source = Pipe::create();
+    auto copy = Pipe::create();
+    auto sink = Pipe::create();
+
+    std::string data = "zero copy";
+    ASSERT_EQ(source[1].write(reinterpret_cast<const uint8_t *>(data.data()), data.size()), data.size());
+
+    // tee leaves the data in the source pipe
+    EXPECT_EQ(Relay::tee(source[0], copy[1], 64), data.size());
+    EXPECT_EQ(source[0].bytes_queued(), data.size());
+    EXPECT_EQ(Relay::splice(source[0], sink[1], 64), data.size());
+    EXPECT_EQ(source[0].bytes_queued(), 0);
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(copy[0].read(buffer.data(), buffer.size()), data.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + data.size()), data);
+    ASSERT_EQ(sink[0].read(buffer.data(), buffer.size()), data.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + data.size()), data);
+
+    EXPECT_EQ(Relay::splice(File(), sink[1], 64), -1);
+}
+
+TEST_F(RelayTest, Vmsplice) {
+    auto pipe = Pipe::create();
+    std::string a = "vm", b = "splice";
+    struct iovec iov[2] = {{a.data(), a.size()}, {b.data(), b.size()}};
+    ASSERT_EQ(Relay::vmsplice(pipe[1], iov, 2), a.size() + b.size());
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(pipe[0].read(buffer.data(), buffer.size()), a.size() + b.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + 8), "vmsplice");
+}
+
+TEST_F(RelayTest, ForwardsAndRecords) {
+    auto input = Pipe::create();
+    auto output = Pipe::create();
+    File recording(record_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    Relay relay(input[0], output[1], recording);
+    ASSERT_TRUE(relay.ok());
+    ASSERT_TRUE(relay.is_recording());
+
+    std::string data = "Hello, Relay!";
+    input[1].write(reinterpret_cast<const uint8_t *>(data.data()), data.size());
+    input[1] = Pipe();
+
+    ASSERT_EQ(relay.forward(), data.size());
+    EXPECT_EQ(relay.forward(), 0);
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(output[0].read(buffer.data(), buffer.size()), data.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + data.size()), data);
+
+    // End of input finishes the recording branch
+    EXPECT_EQ(relay.record(), data.size());
+    EXPECT_EQ(relay.record(), 0);
+    EXPECT_EQ(read_record(), data);
+    EXPECT_EQ(relay.dropped(), 0);
+}
+
+TEST_F(RelayTest, SlowRecordingDoesNotBlockOutput) {
+    auto input = Pipe::create();
+    auto output = Pipe::create();
+    File recording(record_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    Relay relay(input[0], output[1], recording, 4096);
+    ASSERT_TRUE(relay.ok());
+
+    // Nothing drains the recording pipe, so it fills up
+    std::vector<uint8_t> chunk(4096, 'x');
+    std::vector<uint8_t> buffer(chunk.size());
+    for (int i = 0; i < 32; i++) {
+        ASSERT_EQ(input[1].write(chunk.data(), chunk.size()), chunk.size());
+        ASSERT_EQ(relay.forward(), chunk.size());
+        ASSERT_EQ(output[0].read(buffer.data(), buffer.size()), chunk.size());
+    }
+    EXPECT_GT(relay.dropped(), 0);
+
+    relay.finish();
+    size_t recorded = 0;
+    ssize_t n;
+    while ((n = relay.record()) > 0) {
+        recorded += n;
+    }
+    EXPECT_EQ(n, 0);
+    EXPECT_EQ(recorded + relay.dropped(), 32 * chunk.size());
+}
+
+TEST_F(RelayTest, DropsWholeChunks) {
+    auto input = Pipe::create();
+    auto output = Pipe::create();
+    File recording(record_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    Relay relay(input[0], output[1], recording, 4 * 4096);
+    ASSERT_TRUE(relay.ok());
+
+    // Only one chunk fits; the second must not be cut to fill the rest
+    std::vector<uint8_t> chunk(3 * 4096, 'x');
+    std::vector<uint8_t> buffer(chunk.size());
+    for (int i = 0; i < 4; i++) {
+        ASSERT_EQ(input[1].write(chunk.data(), chunk.size()), chunk.size());
+        ASSERT_EQ(relay.forward(), chunk.size());
+        ASSERT_EQ(output[0].read(buffer.data(), buffer.size()), chunk.size());
+    }
+
+    relay.finish();
+    size_t recorded = 0;
+    ssize_t n;
+    while ((n = relay.record()) > 0) {
+        recorded += n;
+    }
+    EXPECT_EQ(recorded, chunk.size());
+    EXPECT_EQ(relay.dropped(), 3 * chunk.size());
+}
+
+TEST_F(RelayTest, RecordsOnAnotherThread) {
+    auto input = Pipe::create();
+    auto output = Pipe::create();
+    File recording(record_filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    Relay relay(input[0], output[1], recording);
+
+    std::thread recorder([&relay]() {
+        while (relay.record() > 0) {
+        }
+    });
+
+    std::string expected;
+    std::vector<uint8_t> buffer(64);
+    for (int i = 0; i < 100; i++) {
+        std::string line = "line " + std::to_string(i) + "\n";
+        expected += line;
+        input[1].write(reinterpret_cast<const uint8_t *>(line.data()), line.size());
+        ASSERT_EQ(relay.forward(), line.size());
+        ASSERT_EQ(output[0].read(buffer.data(), buffer.size()), line.size());
+    }
+    relay.finish();
+    recorder.join();
+
+    EXPECT_EQ(relay.dropped(), 0);
+    EXPECT_EQ(read_record(), expected);
+}
@@ -0,0 +1,73 @@
+#include "rix/ipc/sequence_filter.hpp"
+
+#include <gtest/gtest.h>
+
+using namespace rix::ipc;
+
+TEST(SequenceFilterTest, AcceptsFirstMessage) {
+    SequenceFilter filter;
+    EXPECT_TRUE(filter.accept(42));
+    EXPECT_EQ(filter.last(), 42);
+    EXPECT_EQ(filter.dropped(), 0);
+}
+
+TEST(SequenceFilterTest, DropsStaleAndDuplicateMessages) {
+    SequenceFilter filter;
+    EXPECT_TRUE(filter.accept(1));
+    EXPECT_TRUE(filter.accept(3));
+    EXPECT_FALSE(filter.accept(2));
+    EXPECT_FALSE(filter.accept(3));
+    EXPECT_TRUE(filter.accept(10));
+    EXPECT_EQ(filter.last(), 10);
+    EXPECT_EQ(filter.dropped(), 2);
+}
+
+TEST(SequenceFilterTest, WrapsAround) {
+    SequenceFilter filter;
+    EXPECT_TRUE(filter.accept(UINT32_MAX - 1));
+    EXPECT_TRUE(filter.accept(1));
+    EXPECT_FALSE(filter.accept(UINT32_MAX));
+}
+
+TEST(SequenceFilterTest, AcceptsRestartedSender) {
+    SequenceFilter filter(100);
+    EXPECT_TRUE(filter.accept(5000));
+    EXPECT_FALSE(filter.accept(4950));
+    EXPECT_TRUE(filter.accept(0));
+    EXPECT_TRUE(filter.accept(1));
+
+    filter.reset();
+    EXPECT_TRUE(filter.accept(0));
+}
+
+TEST(SequenceFilterTest, AcceptsSenderRestartedByStamp) {
+    using rix::util::Time;
+    SequenceFilter filter;
+    EXPECT_TRUE(filter.accept(40, Time(10, 0)));
+    EXPECT_TRUE(filter.accept(42, Time(10, 200)));
+    EXPECT_FALSE(filter.accept(41, Time(10, 100)));
+    EXPECT_FALSE(filter.accept(42, Time(10, 200)));
+
+    // The sender restarts its count at zero but its stamps keep moving forward
+    EXPECT_TRUE(filter.accept(0, Time(12, 0)));
+    EXPECT_TRUE(filter.accept(1, Time(12, 100)));
+    EXPECT_FALSE(filter.accept(0, Time(12, 0)));
+    EXPECT_EQ(filter.last(), 1);
+    EXPECT_EQ(filter.dropped(), 3);
+    EXPECT_EQ(filter.restarts(), 1);
+}
+
+TEST(SequenceFilterTest, AcceptsSenderClockSteppingBack) {
+    using rix::util::Time;
+    SequenceFilter filter;
+    EXPECT_TRUE(filter.accept(10, Time(100, 0)));
+
+    // The sender's clock steps back, but its sequence numbers keep moving
+    // forward
+    EXPECT_TRUE(filter.accept(11, Time(50, 0)));
+    EXPECT_TRUE(filter.accept(12, Time(50, 100)));
+    EXPECT_FALSE(filter.accept(11, Time(50, 0)));
+    EXPECT_TRUE(filter.accept(13, Time(50, 200)));
+    EXPECT_EQ(filter.dropped(), 1);
+    EXPECT_EQ(filter.restarts(), 0);
+}
@@ -36,6 +36,7 @@ deserialize_message_vector
 #include <gtest/gtest.h>
 
 #include "rix/msg/message.hpp"
+#include "rix/msg/standard/UInt32.hpp"
 
 using namespace rix::msg::detail;
 
@@ -136,6 +137,17 @@ TEST(Size, MessageVectorTest) {
     EXPECT_EQ(size_message_vector(vec1), 16) << "size_message_vector incorrect";
 }
 
+TEST(Size, StaticSizeTest) {
+    static_assert(rix::msg::static_size_v<uint16_t> == 2);
+    static_assert(!rix::msg::has_static_size_v<std::string>);
+    static_assert(!rix::msg::has_static_size_v<TestMessage>);
+
+    std::vector<rix::msg::standard::UInt32> vec(5);
+    EXPECT_EQ(size_message_vector(vec), 24) << "size_message_vector incorrect for a static size message.";
+    std::array<rix::msg::standard::UInt32, 3> arr;
+    EXPECT_EQ(size_message_array(arr), 12) << "size_message_array incorrect for a static size message.";
+}
+
 TEST(Serialize, NumberTest) {
     std::vector<uint8_t> buffer;
     const size_t expected_size = 44;
@@ -247,6 +259,24 @@ TEST(Serialize, NumberTest) {
     EXPECT_EQ(ui8_copy, ui8) << "serialize_number encoded value incorrect.";
 }
 
+TEST(Serialize, NumbersTest) {
+    std::vector<uint8_t> buffer(64);
+    uint32_t ui32 = 512;
+    double f64 = 2048;
+    int8_t i8 = 16;
+
+    size_t offset = 4;
+    serialize_numbers(buffer.data(), offset, ui32, f64, i8);
+    ASSERT_EQ(offset, 17) << "serialize_numbers offset incorrect.";
+
+    std::vector<uint8_t> expected(64);
+    size_t expected_offset = 4;
+    serialize_number(expected.data(), expected_offset, ui32);
+    serialize_number(expected.data(), expected_offset, f64);
+    serialize_number(expected.data(), expected_offset, i8);
+    EXPECT_EQ(buffer, expected) << "serialize_numbers differs from serialize_number.";
+}
+
 TEST(Serialize, StringTest) {
     std::vector<uint8_t> buffer;
     const size_t expected_size = 67;
@@ -506,6 +536,32 @@ TEST(Deserialize, Number_Fail_TooShort) {
     EXPECT_FALSE(deserialize_number(result, bytes, sizeof(bytes), offset));
 }
 
+TEST(Deserialize, Numbers_Success) {
+    uint8_t bytes[sizeof(uint32_t) + sizeof(float)];
+    uint32_t a = 0x12345678;
+    float b = 1.5f;
+    std::memcpy(bytes, &a, sizeof(a));
+    std::memcpy(bytes + sizeof(a), &b, sizeof(b));
+
+    uint32_t result_a;
+    float result_b;
+    size_t offset = 0;
+    EXPECT_TRUE(deserialize_numbers(bytes, sizeof(bytes), offset, result_a, result_b));
+    EXPECT_EQ(result_a, a);
+    EXPECT_EQ(result_b, b);
+    EXPECT_EQ(offset, sizeof(bytes));
+}
+
+TEST(Deserialize, Numbers_Fail_TooShort) {
+    uint8_t bytes[6] = {0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc};
+    uint32_t a = 0;
+    uint32_t b = 0;
+    size_t offset = 0;
+    EXPECT_FALSE(deserialize_numbers(bytes, sizeof(bytes), offset, a, b));
+    EXPECT_EQ(a, 0) << "deserialize_numbers modified a field on failure.";
+    EXPECT_EQ(offset, 0);
+}
+
 TEST(Deserialize, String_Success) {
     std::string input = "hello";
     uint32_t len = input.size();
@@ -607,6 +663,61 @@ TEST(Deserialize, NumberVector_Fail_TooShort) {
     EXPECT_FALSE(deserialize_number_vector(result, bytes, sizeof(bytes), offset));
 }
 
+TEST(Deserialize, NumberVector_Fail_LengthOverflow) {
+    uint8_t bytes[8] = {0xff, 0xff, 0xff, 0xff, 1, 2, 3, 4}; // Claims 2^32 - 1 elements
+    std::vector<uint64_t> result;
+    size_t offset = 0;
+    EXPECT_FALSE(deserialize_number_vector(result, bytes, sizeof(bytes), offset));
+}
+
+TEST(Deserialize, BoolVector_Success) {
+    std::vector<bool> input = {true, false, true, true};
+    std::vector<uint8_t> bytes(size_number_vector(input));
+    size_t offset = 0;
+    serialize_number_vector(bytes.data(), offset, input);
+
+    std::vector<bool> result;
+    offset = 0;
+    EXPECT_TRUE(deserialize_number_vector(result, bytes.data(), bytes.size(), offset));
+    EXPECT_EQ(result, input);
+    EXPECT_EQ(offset, bytes.size());
+}
+
+TEST(Deserialize, BigEndianVector_Success) {
+    std::vector<uint32_t> input = {0x12345678, 0x9abcdef0};
+    std::vector<uint8_t> bytes(size_number_vector(input));
+    size_t offset = 0;
+    serialize_number_vector<std::endian::big>(bytes.data(), offset, input);
+
+    // The length and the elements are both most significant byte first
+    std::vector<uint8_t> expected = {0, 0, 0, 2, 0x12, 0x34, 0x56, 0x78, 0x9a, 0xbc, 0xde, 0xf0};
+    EXPECT_EQ(bytes, expected);
+
+    std::vector<uint32_t> result;
+    offset = 0;
+    EXPECT_TRUE(deserialize_number_vector<std::endian::big>(result, bytes.data(), bytes.size(), offset));
+    EXPECT_EQ(result, input);
+}
+
+TEST(Deserialize, BigEndianArray_Success) {
+    std::array<double, 3> input = {1.5, -2.25, 1e300};
+    std::array<int16_t, 2> shorts = {0x0102, -2};
+    std::vector<uint8_t> bytes(size_number_array(input) + size_number_array(shorts));
+    size_t offset = 0;
+    serialize_number_array<std::endian::big>(bytes.data(), offset, input);
+    serialize_number_array<std::endian::big>(bytes.data(), offset, shorts);
+    EXPECT_EQ(bytes[24], 0x01);
+    EXPECT_EQ(bytes[25], 0x02);
+
+    std::array<double, 3> result;
+    std::array<int16_t, 2> result_shorts;
+    offset = 0;
+    EXPECT_TRUE(deserialize_number_array<std::endian::big>(result, bytes.data(), bytes.size(), offset));
+    EXPECT_TRUE(deserialize_number_array<std::endian::big>(result_shorts, bytes.data(), bytes.size(), offset));
+    EXPECT_EQ(result, input);
+    EXPECT_EQ(result_shorts, shorts);
+}
+
 TEST(Deserialize, StringVector_Success) {
     std::vector<std::string> input = {"one", "two"};
     std::vector<uint8_t> bytes;
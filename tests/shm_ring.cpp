@@ -0,0 +1,164 @@
+#include "rix/ipc/shm_ring.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace rix::ipc;
+
+class ShmRingTest : public ::testing::Test {
+   protected:
+    std::string name = "rix_test_shm_ring";
+
+    void SetUp() override { ShmRing::remove(name); }
+
+    void TearDown() override { ShmRing::remove(name); }
+};
+
+TEST_F(ShmRingTest, DefaultConstructor) {
+    ShmRing ring;
+    EXPECT_FALSE(ring.ok());
+    uint8_t byte = 0;
+    EXPECT_EQ(ring.read(&byte, 1), -1);
+    EXPECT_EQ(ring.write(&byte, 1), -1);
+}
+
+TEST_F(ShmRingTest, CreatesSharedMemoryObject) {
+    ShmRing writer(name, ShmRing::Mode::WRITE, 1024);
+    ASSERT_TRUE(writer.ok());
+    EXPECT_EQ(writer.capacity(), 1024);
+    EXPECT_EQ(writer.name(), "/" + name);
+    EXPECT_EQ(access(("/dev/shm/" + name).c_str(), F_OK), 0);
+
+    // The capacity is chosen by the creator
+    ShmRing reader(name, ShmRing::Mode::READ, 4096);
+    ASSERT_TRUE(reader.ok());
+    EXPECT_EQ(reader.capacity(), 1024);
+}
+
+TEST_F(ShmRingTest, WriteThenRead) {
+    ShmRing writer(name, ShmRing::Mode::WRITE);
+    ShmRing reader(name, ShmRing::Mode::READ);
+
+    const std::string msg = "shared memory";
+    EXPECT_EQ(writer.write(reinterpret_cast<const uint8_t *>(msg.data()), msg.size()), msg.size());
+    EXPECT_TRUE(reader.is_readable());
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(reader.read(buffer.data(), buffer.size()), msg.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.begin() + msg.size()), msg);
+    EXPECT_FALSE(reader.is_readable());
+}
+
+TEST_F(ShmRingTest, WrongEndFails) {
+    ShmRing writer(name, ShmRing::Mode::WRITE);
+    ShmRing reader(name, ShmRing::Mode::READ);
+    uint8_t byte = 0;
+    EXPECT_EQ(writer.read(&byte, 1), -1);
+    EXPECT_EQ(reader.write(&byte, 1), -1);
+}
+
+TEST_F(ShmRingTest, VectoredIOWrapsAround) {
+    ShmRing writer(name, ShmRing::Mode::WRITE, 8);
+    ShmRing reader(name, ShmRing::Mode::READ);
+
+    for (int i = 0; i < 10; i++) {
+        std::string a = "ab", b = std::to_string(i % 10) + "cd";
+        struct iovec out[2] = {{a.data(), a.size()}, {b.data(), b.size()}};
+        ASSERT_EQ(writer.writev(out, 2), 5);
+
+        std::string c(3, '\0'), d(2, '\0');
+        struct iovec in[2] = {{c.data(), c.size()}, {d.data(), d.size()}};
+        ASSERT_EQ(reader.readv(in, 2), 5);
+        EXPECT_EQ(c + d, a + b);
+    }
+}
+
+TEST_F(ShmRingTest, ReadReturnsZeroAfterWriterCloses) {
+    ShmRing reader(name, ShmRing::Mode::READ);
+    {
+        ShmRing writer(name, ShmRing::Mode::WRITE);
+        uint8_t byte = 42;
+        writer.write(&byte, 1);
+    }
+
+    uint8_t byte = 0;
+    EXPECT_EQ(reader.read(&byte, 1), 1);
+    EXPECT_EQ(byte, 42);
+    EXPECT_EQ(reader.read(&byte, 1), 0);
+}
+
+TEST_F(ShmRingTest, WriteFailsAfterReaderCloses) {
+    ShmRing writer(name, ShmRing::Mode::WRITE);
+    { ShmRing reader(name, ShmRing::Mode::READ); }
+
+    uint8_t byte = 0;
+    errno = 0;
+    EXPECT_EQ(writer.write(&byte, 1), -1);
+    EXPECT_EQ(errno, EPIPE);
+}
+
+TEST_F(ShmRingTest, NonBlocking) {
+    ShmRing writer(name, ShmRing::Mode::WRITE, 4, true);
+    ShmRing reader(name, ShmRing::Mode::READ, 4, true);
+    EXPECT_TRUE(reader.is_nonblocking());
+
+    uint8_t buffer[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    errno = 0;
+    EXPECT_EQ(reader.read(buffer, 1), -1);
+    EXPECT_EQ(errno, EAGAIN);
+
+    EXPECT_EQ(writer.write(buffer, 8), 4);
+    errno = 0;
+    EXPECT_EQ(writer.write(buffer, 8), -1);
+    EXPECT_EQ(errno, EAGAIN);
+    EXPECT_FALSE(writer.is_writable());
+}
+
+TEST_F(ShmRingTest, WaitForReadableTimesOut) {
+    ShmRing writer(name, ShmRing::Mode::WRITE);
+    ShmRing reader(name, ShmRing::Mode::READ);
+
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_FALSE(reader.wait_for_readable(rix::util::Duration(0.1)));
+    timer.stop();
+    EXPECT_NEAR(timer.get().to_milliseconds(), 100, 50);
+}
+
+TEST_F(ShmRingTest, BlockingStreamAcrossThreads) {
+    ShmRing writer(name, ShmRing::Mode::WRITE, 64);
+    ShmRing reader(name, ShmRing::Mode::READ);
+
+    // Stream far more than the capacity so that both sides park and wake each other
+    const size_t total = 1 << 20;
+    std::thread producer([&writer, total]() {
+        std::vector<uint8_t> chunk(100);
+        size_t sent = 0;
+        while (sent < total) {
+            size_t len = std::min(chunk.size(), total - sent);
+            for (size_t i = 0; i < len; i++) chunk[i] = static_cast<uint8_t>(sent + i);
+            ASSERT_EQ(writer.write(chunk.data(), len), len);
+            sent += len;
+        }
+        writer = ShmRing();
+    });
+
+    std::vector<uint8_t> buffer(37);
+    size_t received = 0;
+    bool in_order = true;
+    ssize_t n;
+    while ((n = reader.read(buffer.data(), buffer.size())) > 0) {
+        for (ssize_t i = 0; i < n; i++) {
+            in_order &= (buffer[i] == static_cast<uint8_t>(received + i));
+        }
+        received += n;
+    }
+    producer.join();
+
+    EXPECT_EQ(n, 0);
+    EXPECT_EQ(received, total);
+    EXPECT_TRUE(in_order);
+}
@@ -205,6 +205,86 @@ TEST(SignalTest, TestKill) {
     ::signal(SIGINT, SIG_DFL);
 }
 
+TEST(SignalTest, TestIsReady) {
+    Signal sig(SIGUSR1);
+    EXPECT_FALSE(sig.is_ready());
+
+    EXPECT_TRUE(sig.raise());
+    EXPECT_TRUE(sig.raise());
+    EXPECT_TRUE(sig.is_ready());
+    EXPECT_TRUE(sig.is_ready());
+    EXPECT_FALSE(sig.is_ready());
+
+    // Signals consumed by wait are no longer pending
+    EXPECT_TRUE(sig.raise());
+    EXPECT_TRUE(sig.wait(rix::util::Duration(0)));
+    EXPECT_FALSE(sig.is_ready());
+}
+
+TEST(SignalTest, TestRealtimeConstructor) {
+    Signal sig1(SIGRTMIN);
+    EXPECT_EQ(sig1.signum(), SIGRTMIN);
+    Signal sig2(SIGRTMAX);
+    EXPECT_EQ(sig2.signum(), SIGRTMAX);
+    EXPECT_GE(sig2.fd(), 0);
+
+    EXPECT_THROW({ Signal sig3(SIGRTMAX + 1); }, std::invalid_argument);
+    EXPECT_THROW({ Signal sig3(SIGRTMIN); }, std::invalid_argument);
+}
+
+TEST(SignalTest, TestQueuedPayloadsInOrder) {
+    Signal sig(SIGRTMIN + 1);
+    EXPECT_EQ(sig.info().signum, 0);
+
+    for (int i = 0; i < 10; i++) {
+        EXPECT_TRUE(sig.queue(getpid(), i));
+    }
+
+    for (int i = 0; i < 10; i++) {
+        ASSERT_TRUE(sig.wait(rix::util::Duration(0)));
+        EXPECT_EQ(sig.info().signum, SIGRTMIN + 1);
+        EXPECT_EQ(sig.info().value.sival_int, i);
+        EXPECT_EQ(sig.info().code, SI_QUEUE);
+        EXPECT_EQ(sig.info().pid, getpid());
+    }
+    EXPECT_FALSE(sig.wait(rix::util::Duration(0)));
+    EXPECT_EQ(sig.dropped(), 0);
+}
+
+TEST(SignalTest, TestQueuedPointerPayload) {
+    Signal sig(SIGRTMIN);
+    int target = 7;
+    union sigval value;
+    value.sival_ptr = &target;
+    EXPECT_TRUE(sig.queue(getpid(), value));
+    ASSERT_TRUE(sig.is_ready());
+    EXPECT_EQ(sig.info().value.sival_ptr, &target);
+}
+
+TEST(SignalTest, TestQueueOverflowIsCounted) {
+    Signal sig(SIGRTMIN);
+    const size_t extra = 5;
+    for (size_t i = 0; i < Signal::QUEUE_CAPACITY + extra; i++) {
+        ASSERT_TRUE(sig.queue(getpid(), static_cast<int>(i)));
+    }
+    EXPECT_EQ(sig.dropped(), extra);
+
+    // The oldest deliveries are kept
+    for (size_t i = 0; i < Signal::QUEUE_CAPACITY; i++) {
+        ASSERT_TRUE(sig.is_ready());
+        EXPECT_EQ(sig.info().value.sival_int, static_cast<int>(i));
+    }
+    EXPECT_FALSE(sig.is_ready());
+}
+
+TEST(SignalTest, TestRaiseInfo) {
+    Signal sig(SIGUSR2);
+    EXPECT_TRUE(sig.raise());
+    ASSERT_TRUE(sig.wait(rix::util::Duration(0)));
+    EXPECT_EQ(sig.info().signum, SIGUSR2);
+    EXPECT_EQ(sig.info().pid, getpid());
+}
+
 int main(int argc, char** argv) {
   testing::InitGoogleTest(&argc, argv);
   testing::FLAGS_gtest_death_test_style = "threadsafe";
@@ -0,0 +1,159 @@
+#include "rix/ipc/signal_set.hpp"
+
+#include <gtest/gtest.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+static bool is_blocked(int signum) {
+    sigset_t current;
+    pthread_sigmask(SIG_SETMASK, nullptr, &current);
+    return sigismember(&current, signum) == 1;
+}
+
+TEST(SignalSetTest, ConstructorFail) {
+    EXPECT_THROW(SignalSet({}), std::invalid_argument);
+    EXPECT_THROW(SignalSet({SIGUSR1, -1}), std::invalid_argument);
+    EXPECT_THROW(SignalSet({SIGKILL}), std::invalid_argument);
+    EXPECT_THROW(SignalSet({SIGUSR1, SIGSTOP}), std::invalid_argument);
+    EXPECT_FALSE(is_blocked(SIGUSR1));
+}
+
+TEST(SignalSetTest, ConstructorFailsWithoutDescriptors) {
+    struct rlimit limit;
+    ASSERT_EQ(getrlimit(RLIMIT_NOFILE, &limit), 0);
+    struct rlimit none = limit;
+    none.rlim_cur = 0;
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &none), 0);
+
+    try {
+        SignalSet set({SIGUSR1});
+        ADD_FAILURE() << "Expected std::system_error";
+    } catch (const std::system_error &e) {
+        EXPECT_EQ(e.code().value(), EMFILE);
+    }
+    ASSERT_EQ(setrlimit(RLIMIT_NOFILE, &limit), 0);
+    EXPECT_FALSE(is_blocked(SIGUSR1));
+}
+
+TEST(SignalSetTest, BlocksSignalsUntilDestroyed) {
+    {
+        SignalSet set({SIGUSR1, SIGUSR2});
+        EXPECT_TRUE(set.contains(SIGUSR1));
+        EXPECT_TRUE(set.contains(SIGUSR2));
+        EXPECT_FALSE(set.contains(SIGINT));
+        EXPECT_EQ(set.signums(), std::vector<int>({SIGUSR1, SIGUSR2}));
+        EXPECT_TRUE(is_blocked(SIGUSR1));
+        EXPECT_TRUE(is_blocked(SIGUSR2));
+        EXPECT_GE(set.fd(), 0);
+    }
+    EXPECT_FALSE(is_blocked(SIGUSR1));
+    EXPECT_FALSE(is_blocked(SIGUSR2));
+}
+
+TEST(SignalSetTest, WaitsOnSeveralSignals) {
+    SignalSet set({SIGUSR1, SIGUSR2, SIGHUP});
+    EXPECT_FALSE(set.wait(rix::util::Duration(0)));
+    EXPECT_EQ(set.info().ssi_signo, 0);
+
+    EXPECT_TRUE(set.raise(SIGUSR2));
+    EXPECT_TRUE(set.wait(rix::util::Duration(0)));
+    EXPECT_EQ(set.info().ssi_signo, SIGUSR2);
+
+    EXPECT_TRUE(set.raise(SIGHUP));
+    EXPECT_TRUE(set.is_ready());
+    EXPECT_EQ(set.info().ssi_signo, SIGHUP);
+    EXPECT_FALSE(set.is_ready());
+
+    // Raising a signal that is not in the set fails
+    EXPECT_FALSE(set.raise(SIGINT));
+}
+
+TEST(SignalSetTest, RaiseSendsFirstSignal) {
+    SignalSet set({SIGUSR2, SIGUSR1});
+    EXPECT_TRUE(set.raise());
+    EXPECT_TRUE(set.wait(rix::util::Duration(0)));
+    EXPECT_EQ(set.info().ssi_signo, SIGUSR2);
+}
+
+TEST(SignalSetTest, KillReportsSender) {
+    SignalSet set({SIGUSR1});
+    EXPECT_TRUE(set.kill(getpid(), SIGUSR1));
+    EXPECT_TRUE(set.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(set.info().ssi_signo, SIGUSR1);
+    EXPECT_EQ(set.info().ssi_pid, static_cast<uint32_t>(getpid()));
+}
+
+TEST(SignalSetTest, WaitTimesOut) {
+    SignalSet set({SIGUSR1});
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_FALSE(set.wait(rix::util::Duration(0.1)));
+    timer.stop();
+    EXPECT_NEAR(timer.get().to_milliseconds(), 100, 50);
+}
+
+TEST(SignalSetTest, DestructorDiscardsPendingSignals) {
+    {
+        SignalSet set({SIGUSR1});
+        EXPECT_TRUE(set.raise());
+    }
+
+    // The pending signal would terminate the process if it were delivered on
+    // unblock
+    SignalSet set({SIGUSR1});
+    EXPECT_FALSE(set.wait(rix::util::Duration(0)));
+}
+
+TEST(SignalSetTest, KeepsSignalsBlockedBeforeConstruction) {
+    sigset_t mask;
+    sigemptyset(&mask);
+    sigaddset(&mask, SIGUSR2);
+    pthread_sigmask(SIG_BLOCK, &mask, nullptr);
+
+    { SignalSet set({SIGUSR1, SIGUSR2}); }
+    EXPECT_FALSE(is_blocked(SIGUSR1));
+    EXPECT_TRUE(is_blocked(SIGUSR2));
+
+    pthread_sigmask(SIG_UNBLOCK, &mask, nullptr);
+}
+
+TEST(SignalSetTest, MoveConstructor) {
+    SignalSet set1({SIGUSR1});
+    int fd = set1.fd();
+    SignalSet set2(std::move(set1));
+    EXPECT_EQ(set1.fd(), -1);
+    EXPECT_FALSE(set1.raise());
+    EXPECT_EQ(set2.fd(), fd);
+    EXPECT_TRUE(is_blocked(SIGUSR1));
+
+    EXPECT_TRUE(set2.raise());
+    EXPECT_TRUE(set2.wait(rix::util::Duration(0)));
+}
+
+TEST(SignalSetTest, RegistersWithPoller) {
+    SignalSet set({SIGUSR1, SIGUSR2});
+    Poller poller;
+    ASSERT_TRUE(poller.add(set));
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0)).empty());
+
+    std::thread sender([]() {
+        rix::util::sleep_for(rix::util::Duration(0.05));
+        ::kill(getpid(), SIGUSR2);
+    });
+
+    const auto &events = poller.wait(rix::util::Duration(1.0));
+    sender.join();
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, set.fd());
+    EXPECT_TRUE(set.wait(rix::util::Duration(0)));
+    EXPECT_EQ(set.info().ssi_signo, SIGUSR2);
+}
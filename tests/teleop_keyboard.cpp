@@ -154,4 +154,26 @@ TEST(TeleopKeyboardTest, TranslatesInvalidKeysAndExitsOnNotification) {
 
     ASSERT_EQ(twists.size(), 3); // a, d, e
     validate_twists(data, 5, twists); // abcde
-}
\ No newline at end of file
+}
+
+TEST(TeleopKeyboardTest, AsyncSpinTranslatesKeysAndExitsOnEOF) {
+    auto input = std::make_unique<testing::NiceMock<MockIO>>();
+    const char *data = "qwe asdx";
+    input->write((uint8_t *)data, 8);
+    input->close_write_end();
+
+    auto output = std::make_unique<testing::NiceMock<MockIO>>();
+    auto output_ptr = output.get();  // Get raw pointer for inspection
+
+    init_twist_map(0.5, 1.5);
+    auto teleop_keyboard = std::make_unique<TeleopKeyboard>(std::move(input), std::move(output), 0.5, 1.5);
+    auto notif = std::make_unique<testing::NiceMock<MockNotification>>();
+
+    teleop_keyboard->spin_async(std::move(notif));
+
+    std::vector<rix::msg::geometry::Twist2DStamped> twists;
+    convert_buffer_to_twists(output_ptr->get_buffer(), twists);
+
+    ASSERT_EQ(twists.size(), 7);
+    validate_twists(data, 8, twists);
+}
@@ -0,0 +1,111 @@
+#include "rix/ipc/timer_fd.hpp"
+
+#include <gtest/gtest.h>
+
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+TEST(TimerFdTest, Constructor) {
+    TimerFd timer;
+    EXPECT_TRUE(timer.ok());
+    EXPECT_GE(timer.fd(), 0);
+    EXPECT_FALSE(timer.is_armed());
+    EXPECT_FALSE(timer.is_ready());
+}
+
+TEST(TimerFdTest, OneShot) {
+    TimerFd timer;
+    ASSERT_TRUE(timer.start(rix::util::Duration(0.05)));
+    EXPECT_TRUE(timer.is_armed());
+    EXPECT_FALSE(timer.is_ready());
+
+    rix::util::Timer stopwatch;
+    stopwatch.start();
+    EXPECT_TRUE(timer.wait(rix::util::Duration(1.0)));
+    stopwatch.stop();
+    EXPECT_NEAR(stopwatch.get().to_milliseconds(), 50, 25);
+    EXPECT_EQ(timer.expirations(), 1);
+    EXPECT_FALSE(timer.is_armed());
+    EXPECT_FALSE(timer.wait(rix::util::Duration(0.1)));
+}
+
+TEST(TimerFdTest, RejectsZeroDelay) {
+    TimerFd timer;
+    EXPECT_FALSE(timer.start(rix::util::Duration(0.0)));
+    EXPECT_FALSE(timer.is_armed());
+}
+
+TEST(TimerFdTest, PeriodicCountsOverruns) {
+    TimerFd timer;
+    ASSERT_TRUE(timer.start(rix::util::Duration(0.02), rix::util::Duration(0.02)));
+    EXPECT_NEAR(timer.period().to_milliseconds(), 20, 1);
+
+    EXPECT_TRUE(timer.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(timer.overruns(), timer.expirations() - 1);
+
+    // Miss several periods
+    rix::util::sleep_for(rix::util::Duration(0.11));
+    EXPECT_TRUE(timer.is_ready());
+    EXPECT_GE(timer.expirations(), 4);
+    EXPECT_GE(timer.overruns(), 3);
+    EXPECT_TRUE(timer.is_armed());
+
+    EXPECT_TRUE(timer.stop());
+    EXPECT_FALSE(timer.is_armed());
+    EXPECT_FALSE(timer.wait(rix::util::Duration(0.05)));
+}
+
+TEST(TimerFdTest, AbsoluteDeadline) {
+    TimerFd timer;
+    rix::util::Duration deadline = TimerFd::now() + rix::util::Duration(0.05);
+    ASSERT_TRUE(timer.start_at(deadline));
+    EXPECT_TRUE(timer.wait(rix::util::Duration(1.0)));
+    EXPECT_GE(TimerFd::now(), deadline);
+
+    // A deadline in the past expires immediately
+    ASSERT_TRUE(timer.start_at(TimerFd::now() - rix::util::Duration(1.0)));
+    EXPECT_TRUE(timer.wait(rix::util::Duration(0.01)));
+}
+
+TEST(TimerFdTest, RaiseKeepsSchedule) {
+    TimerFd timer;
+    EXPECT_TRUE(timer.raise());
+    EXPECT_TRUE(timer.is_ready());
+
+    ASSERT_TRUE(timer.start(rix::util::Duration(10.0), rix::util::Duration(10.0)));
+    EXPECT_TRUE(timer.raise());
+    EXPECT_TRUE(timer.is_ready());
+    EXPECT_TRUE(timer.is_armed());
+    EXPECT_NEAR(timer.period().to_milliseconds(), 10000, 1);
+}
+
+TEST(TimerFdTest, MoveConstructor) {
+    TimerFd timer1;
+    int fd = timer1.fd();
+    TimerFd timer2(std::move(timer1));
+    EXPECT_FALSE(timer1.ok());
+    EXPECT_FALSE(timer1.start(rix::util::Duration(1.0)));
+    EXPECT_EQ(timer2.fd(), fd);
+}
+
+TEST(TimerFdTest, PollsAlongsideFile) {
+    TimerFd timer;
+    auto [reader, writer] = Pipe::create();
+    Poller poller;
+    ASSERT_TRUE(poller.add(timer));
+    ASSERT_TRUE(poller.add(reader));
+
+    ASSERT_TRUE(timer.start(rix::util::Duration(0.05)));
+    const auto &events = poller.wait(rix::util::Duration(1.0));
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, timer.fd());
+    EXPECT_TRUE(timer.is_ready());
+
+    uint8_t byte = 1;
+    writer.write(&byte, 1);
+    const auto &events2 = poller.wait(rix::util::Duration(1.0));
+    ASSERT_EQ(events2.size(), 1);
+    EXPECT_EQ(events2[0].fd, reader.fd());
+}
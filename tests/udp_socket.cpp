@@ -0,0 +1,118 @@
+#include "rix/ipc/udp_socket.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+TEST(UdpSocketTest, DefaultConstructor) {
+    UdpSocket socket;
+    EXPECT_FALSE(socket.ok());
+    EXPECT_EQ(socket.port(), 0);
+    EXPECT_FALSE(socket.connect("127.0.0.1", 9));
+}
+
+TEST(UdpSocketTest, InvalidAddress) {
+    UdpSocket socket("not an address", 0);
+    EXPECT_FALSE(socket.ok());
+
+    UdpSocket valid("127.0.0.1", 0);
+    ASSERT_TRUE(valid.ok());
+    EXPECT_FALSE(valid.connect("localhost", 9));
+}
+
+TEST(UdpSocketTest, EachWriteIsOneDatagram) {
+    UdpSocket receiver("127.0.0.1", 0);
+    ASSERT_TRUE(receiver.ok());
+    ASSERT_NE(receiver.port(), 0);
+
+    UdpSocket sender("127.0.0.1", 0);
+    ASSERT_TRUE(sender.connect("127.0.0.1", receiver.port()));
+
+    std::vector<uint8_t> a = {1, 2, 3}, b = {4, 5, 6, 7, 8};
+    EXPECT_EQ(sender.write(a.data(), a.size()), a.size());
+    struct iovec iov[2] = {{b.data(), 2}, {b.data() + 2, 3}};
+    EXPECT_EQ(sender.writev(iov, 2), b.size());
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(receiver.read(buffer.data(), buffer.size()), a.size());
+    ASSERT_EQ(receiver.read(buffer.data(), buffer.size()), b.size());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + b.size()), b);
+}
+
+TEST(UdpSocketTest, BatchSendAndReceive) {
+    UdpSocket receiver("127.0.0.1", 0, true);
+    UdpSocket sender("127.0.0.1", 0);
+    ASSERT_TRUE(sender.connect("127.0.0.1", receiver.port()));
+
+    std::vector<std::vector<uint8_t>> sent;
+    for (int i = 1; i <= 5; i++) {
+        sent.emplace_back(i, static_cast<uint8_t>(i));
+    }
+    ASSERT_EQ(sender.send_batch(sent), 5);
+    EXPECT_EQ(sender.send_batch({}), 0);
+
+    ASSERT_TRUE(receiver.wait_for_readable(rix::util::Duration(1.0)));
+    std::vector<std::vector<uint8_t>> received;
+    ASSERT_EQ(receiver.recv_batch(received, 3), 3);
+    ASSERT_EQ(receiver.recv_batch(received), 2);
+    EXPECT_EQ(received[0], sent[3]);
+    EXPECT_EQ(received[1], sent[4]);
+
+    errno = 0;
+    EXPECT_EQ(receiver.recv_batch(received), -1);
+    EXPECT_EQ(errno, EAGAIN);
+    EXPECT_TRUE(received.empty());
+}
+
+TEST(UdpSocketTest, ConnectFiltersOtherSenders) {
+    UdpSocket receiver("127.0.0.1", 0, true);
+    UdpSocket peer("127.0.0.1", 0), other("127.0.0.1", 0);
+    ASSERT_TRUE(receiver.connect("127.0.0.1", peer.port()));
+    ASSERT_TRUE(peer.connect("127.0.0.1", receiver.port()));
+    ASSERT_TRUE(other.connect("127.0.0.1", receiver.port()));
+
+    uint8_t byte = 1;
+    other.write(&byte, 1);
+    byte = 2;
+    peer.write(&byte, 1);
+
+    ASSERT_TRUE(receiver.wait_for_readable(rix::util::Duration(1.0)));
+    std::vector<std::vector<uint8_t>> received;
+    ASSERT_EQ(receiver.recv_batch(received), 1);
+    EXPECT_EQ(received[0], std::vector<uint8_t>({2}));
+}
+
+TEST(UdpSocketTest, SocketOptions) {
+    UdpSocket socket("127.0.0.1", 0);
+    EXPECT_TRUE(socket.set_low_latency());
+    EXPECT_TRUE(socket.set_busy_poll(0));
+    EXPECT_FALSE(UdpSocket().set_busy_poll(0));
+}
+
+TEST(UdpSocketTest, MulticastLoopback) {
+    const std::string group = "239.255.42.99";
+    UdpSocket receiver("0.0.0.0", 0);
+    ASSERT_TRUE(receiver.ok());
+    if (!receiver.join_group(group, "127.0.0.1")) {
+        GTEST_SKIP() << "Multicast is not available on the loopback interface";
+    }
+
+    UdpSocket sender("127.0.0.1", 0);
+    ASSERT_TRUE(sender.set_multicast_interface("127.0.0.1"));
+    ASSERT_TRUE(sender.connect(group, receiver.port()));
+
+    std::vector<uint8_t> msg = {9, 8, 7};
+    ASSERT_EQ(sender.write(msg.data(), msg.size()), msg.size());
+
+    Poller poller;
+    ASSERT_TRUE(poller.add(receiver));
+    ASSERT_EQ(poller.wait(rix::util::Duration(1.0)).size(), 1);
+    std::vector<std::vector<uint8_t>> received;
+    ASSERT_EQ(receiver.recv_batch(received), 1);
+    EXPECT_EQ(received[0], msg);
+}
@@ -0,0 +1,126 @@
+#include "rix/ipc/unix_socket.hpp"
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <string>
+#include <vector>
+
+#include "rix/ipc/poller.hpp"
+
+using namespace rix::ipc;
+
+class UnixSocketTest : public ::testing::Test {
+   protected:
+    std::string path = "/tmp/rix_test_unix_socket";
+
+    void SetUp() override { unlink(path.c_str()); }
+
+    void TearDown() override { unlink(path.c_str()); }
+};
+
+static std::vector<uint8_t> bytes(const std::string &s) { return std::vector<uint8_t>(s.begin(), s.end()); }
+
+TEST_F(UnixSocketTest, DefaultConstructor) {
+    UnixSocket socket;
+    EXPECT_FALSE(socket.ok());
+    UnixListener listener;
+    EXPECT_FALSE(listener.ok());
+    EXPECT_FALSE(listener.accept().ok());
+}
+
+TEST_F(UnixSocketTest, ConnectWithoutListenerFails) {
+    UnixSocket socket(path);
+    EXPECT_FALSE(socket.ok());
+}
+
+TEST_F(UnixSocketTest, ListenerRemovesSocketFile) {
+    {
+        UnixListener listener(path);
+        ASSERT_TRUE(listener.ok());
+        EXPECT_EQ(listener.pathname(), path);
+        EXPECT_EQ(access(path.c_str(), F_OK), 0);
+
+        UnixListener moved(std::move(listener));
+        EXPECT_FALSE(listener.ok());
+        EXPECT_TRUE(moved.ok());
+    }
+    EXPECT_NE(access(path.c_str(), F_OK), 0);
+}
+
+TEST_F(UnixSocketTest, PreservesMessageBoundaries) {
+    UnixListener listener(path);
+    UnixSocket client(path);
+    ASSERT_TRUE(client.ok());
+    UnixSocket server = listener.accept();
+    ASSERT_TRUE(server.ok());
+    EXPECT_EQ(server.peer_pid(), getpid());
+
+    auto a = bytes("abc"), b = bytes("defgh");
+    EXPECT_EQ(client.write(a.data(), a.size()), a.size());
+    struct iovec iov[2] = {{b.data(), 2}, {b.data() + 2, 3}};
+    EXPECT_EQ(client.writev(iov, 2), b.size());
+
+    std::vector<uint8_t> buffer(64);
+    ASSERT_EQ(server.read(buffer.data(), buffer.size()), a.size());
+    ASSERT_EQ(server.read(buffer.data(), buffer.size()), b.size());
+    EXPECT_EQ(std::vector<uint8_t>(buffer.begin(), buffer.begin() + b.size()), b);
+
+    // The connection is bidirectional
+    EXPECT_EQ(server.write(a.data(), a.size()), a.size());
+    EXPECT_EQ(client.read(buffer.data(), buffer.size()), a.size());
+}
+
+TEST_F(UnixSocketTest, BatchReceive) {
+    auto [client, server] = UnixSocket::pair();
+    for (int i = 1; i <= 5; i++) {
+        std::vector<uint8_t> msg(i, static_cast<uint8_t>(i));
+        ASSERT_EQ(client.write(msg.data(), msg.size()), i);
+    }
+
+    std::vector<std::vector<uint8_t>> messages;
+    ASSERT_EQ(server.recv_batch(messages, 3), 3);
+    ASSERT_EQ(messages.size(), 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(messages[i], std::vector<uint8_t>(i + 1, static_cast<uint8_t>(i + 1)));
+    }
+
+    ASSERT_EQ(server.recv_batch(messages), 2);
+    EXPECT_EQ(messages[0].size(), 4);
+    EXPECT_EQ(messages[1].size(), 5);
+
+    server.set_nonblocking(true);
+    errno = 0;
+    EXPECT_EQ(server.recv_batch(messages), -1);
+    EXPECT_EQ(errno, EAGAIN);
+}
+
+TEST_F(UnixSocketTest, DetectsPeerClose) {
+    auto [client, server] = UnixSocket::pair();
+    auto msg = bytes("last");
+    client.write(msg.data(), msg.size());
+    client = UnixSocket();
+
+    std::vector<std::vector<uint8_t>> messages;
+    ASSERT_EQ(server.recv_batch(messages), 1);
+    EXPECT_EQ(messages[0], msg);
+    EXPECT_EQ(server.recv_batch(messages), 0);
+
+    // Writing to a closed peer fails instead of raising SIGPIPE
+    errno = 0;
+    EXPECT_EQ(server.write(msg.data(), msg.size()), -1);
+    EXPECT_EQ(errno, EPIPE);
+}
+
+TEST_F(UnixSocketTest, ListenerIsPollable) {
+    UnixListener listener(path);
+    Poller poller;
+    ASSERT_TRUE(poller.add(listener));
+    EXPECT_TRUE(poller.wait(rix::util::Duration(0)).empty());
+
+    UnixSocket client(path);
+    const auto &events = poller.wait(rix::util::Duration(1.0));
+    ASSERT_EQ(events.size(), 1);
+    EXPECT_EQ(events[0].fd, listener.fd());
+    EXPECT_TRUE(listener.accept(true).is_nonblocking());
+}
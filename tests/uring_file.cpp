@@ -0,0 +1,154 @@
+#include "rix/ipc/uring_file.hpp"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+#include "rix/ipc/pipe.hpp"
+
+using namespace rix::ipc;
+
+class UringFileTest : public ::testing::TestWithParam<unsigned> {};
+
+// Run every test with io_uring (queue depth 8) and with the syscall fallback (queue depth 0)
+INSTANTIATE_TEST_SUITE_P(Backends, UringFileTest, ::testing::Values(8u, 0u));
+
+TEST(UringFileConstructorTest, DefaultConstructor) {
+    UringFile f;
+    EXPECT_FALSE(f.ok());
+    EXPECT_FALSE(f.is_uring());
+    uint8_t byte = 0;
+    EXPECT_EQ(f.read(&byte, 1), -1);
+    EXPECT_EQ(f.write(&byte, 1), -1);
+    EXPECT_FALSE(f.queue_write(&byte, 1));
+}
+
+TEST(UringFileConstructorTest, DisabledByZeroQueueDepth) {
+    auto [reader, writer] = Pipe::create();
+    UringFile f(::dup(writer.fd()), 0);
+    EXPECT_TRUE(f.ok());
+    EXPECT_FALSE(f.is_uring());
+}
+
+TEST_P(UringFileTest, ReadWrite) {
+    auto [reader, writer] = Pipe::create();
+    UringFile in(::dup(reader.fd()), GetParam());
+    UringFile out(::dup(writer.fd()), GetParam());
+
+    const std::string msg = "uring";
+    EXPECT_EQ(out.write(reinterpret_cast<const uint8_t *>(msg.data()), msg.size()), msg.size());
+
+    std::vector<uint8_t> buffer(msg.size());
+    EXPECT_EQ(in.read(buffer.data(), buffer.size()), msg.size());
+    EXPECT_EQ(std::string(buffer.begin(), buffer.end()), msg);
+}
+
+TEST_P(UringFileTest, ReadvWritev) {
+    auto [reader, writer] = Pipe::create();
+    UringFile in(::dup(reader.fd()), GetParam());
+    UringFile out(::dup(writer.fd()), GetParam());
+
+    std::string a = "head", b = "tail";
+    struct iovec iov[2];
+    iov[0].iov_base = a.data();
+    iov[0].iov_len = a.size();
+    iov[1].iov_base = b.data();
+    iov[1].iov_len = b.size();
+    EXPECT_EQ(out.writev(iov, 2), 8);
+
+    std::string c(4, '\0'), d(4, '\0');
+    iov[0].iov_base = c.data();
+    iov[1].iov_base = d.data();
+    EXPECT_EQ(in.readv(iov, 2), 8);
+    EXPECT_EQ(c, "head");
+    EXPECT_EQ(d, "tail");
+}
+
+TEST_P(UringFileTest, QueuedWritesKeepOrder) {
+    auto [reader, writer] = Pipe::create();
+    UringFile out(::dup(writer.fd()), GetParam());
+
+    std::vector<std::string> chunks;
+    for (int i = 0; i < 20; i++) {
+        chunks.push_back(std::to_string(i) + ",");
+    }
+
+    // 20 writes overflow the queue depth of 8, which forces intermediate flushes
+    size_t expected = 0;
+    for (const auto &chunk : chunks) {
+        ASSERT_TRUE(out.queue_write(reinterpret_cast<const uint8_t *>(chunk.data()), chunk.size()));
+        expected += chunk.size();
+    }
+    EXPECT_GT(out.queued(), 0);
+    EXPECT_GE(out.flush(), 0);
+    EXPECT_EQ(out.queued(), 0);
+
+    std::vector<uint8_t> buffer(expected);
+    EXPECT_EQ(reader.read(buffer.data(), buffer.size()), expected);
+
+    std::string result(buffer.begin(), buffer.end());
+    std::string concatenated;
+    for (const auto &chunk : chunks) concatenated += chunk;
+    EXPECT_EQ(result, concatenated);
+}
+
+TEST_P(UringFileTest, QueuedReads) {
+    auto [reader, writer] = Pipe::create();
+    UringFile in(::dup(reader.fd()), GetParam());
+
+    const std::string msg = "abcdef";
+    writer.write(reinterpret_cast<const uint8_t *>(msg.data()), msg.size());
+
+    uint8_t a[2], b[4];
+    ASSERT_TRUE(in.queue_read(a, sizeof(a)));
+    ASSERT_TRUE(in.queue_read(b, sizeof(b)));
+    EXPECT_EQ(in.flush(), 6);
+    EXPECT_EQ(std::string(a, a + 2), "ab");
+    EXPECT_EQ(std::string(b, b + 4), "cdef");
+}
+
+TEST_P(UringFileTest, ShortQueuedReadEndsBatch) {
+    auto [reader, writer] = Pipe::create();
+    UringFile in(::dup(reader.fd()), GetParam());
+
+    const std::string msg = "abcde";
+    writer.write(reinterpret_cast<const uint8_t *>(msg.data()), msg.size());
+
+    // The second read is short, so the third is not performed
+    uint8_t a[2], b[4], c[2];
+    ASSERT_TRUE(in.queue_read(a, sizeof(a)));
+    ASSERT_TRUE(in.queue_read(b, sizeof(b)));
+    ASSERT_TRUE(in.queue_read(c, sizeof(c)));
+    EXPECT_EQ(in.flush(), 5);
+    EXPECT_EQ(in.queued(), 0);
+    EXPECT_EQ(std::string(a, a + 2), "ab");
+    EXPECT_EQ(std::string(b, b + 3), "cde");
+
+    // Later reads see data written after the batch
+    writer.write(reinterpret_cast<const uint8_t *>("fg"), 2);
+    EXPECT_EQ(in.read(c, sizeof(c)), 2);
+    EXPECT_EQ(std::string(c, c + 2), "fg");
+}
+
+TEST_P(UringFileTest, WriteToClosedPipeFails) {
+    auto [reader, writer] = Pipe::create();
+    UringFile out(::dup(writer.fd()), GetParam());
+    reader = Pipe();
+
+    ::signal(SIGPIPE, SIG_IGN);
+    uint8_t byte = 0;
+    errno = 0;
+    EXPECT_EQ(out.write(&byte, 1), -1);
+    EXPECT_EQ(errno, EPIPE);
+    ::signal(SIGPIPE, SIG_DFL);
+}
+
+TEST_P(UringFileTest, ReadEndOfFile) {
+    auto [reader, writer] = Pipe::create();
+    UringFile in(::dup(reader.fd()), GetParam());
+    writer = Pipe();
+
+    uint8_t byte = 0;
+    EXPECT_EQ(in.read(&byte, 1), 0);
+}
@@ -0,0 +1,124 @@
+#include "rix/ipc/wait_strategy.hpp"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "rix/ipc/pipe.hpp"
+#include "rix/ipc/signal.hpp"
+
+using namespace rix::ipc;
+
+TEST(WaitStrategyTest, BlockHonorsSubMillisecondTimeouts) {
+    auto [reader, writer] = Pipe::create();
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_FALSE(WaitStrategy::block(reader.fd(), POLLIN, rix::util::Duration(0.0005)));
+    timer.stop();
+    EXPECT_GE(timer.get().to_nanoseconds(), 500000);
+    EXPECT_LT(timer.get().to_nanoseconds(), 50000000);
+    EXPECT_FALSE(WaitStrategy::block(-1, POLLIN, rix::util::Duration(0)));
+}
+
+TEST(WaitStrategyTest, DefaultStrategyBlocks) {
+    auto [reader, writer] = Pipe::create();
+    EXPECT_EQ(reader.wait_strategy().spin(), rix::util::Duration(0));
+
+    std::thread sender([&writer]() {
+        rix::util::sleep_for(rix::util::Duration(0.02));
+        uint8_t byte = 1;
+        writer.write(&byte, 1);
+    });
+    EXPECT_TRUE(reader.wait_for_readable(rix::util::Duration(1.0)));
+    sender.join();
+
+    EXPECT_EQ(reader.wait_stats().spin_wins, 0);
+    EXPECT_EQ(reader.wait_stats().block_wins, 1);
+    EXPECT_EQ(reader.wait_stats().timeouts, 0);
+}
+
+TEST(WaitStrategyTest, SpinWinsForPromptEvents) {
+    auto [reader, writer] = Pipe::create();
+    reader.set_wait_strategy(WaitStrategy(rix::util::Duration(1.0)));
+
+    std::thread sender([&writer]() {
+        rix::util::sleep_for(rix::util::Duration(0.001));
+        uint8_t byte = 1;
+        writer.write(&byte, 1);
+    });
+    EXPECT_TRUE(reader.wait_for_readable(rix::util::Duration(2.0)));
+    sender.join();
+    EXPECT_EQ(reader.wait_stats().spin_wins, 1);
+    EXPECT_EQ(reader.wait_stats().block_wins, 0);
+
+    // Writable immediately
+    writer.set_wait_strategy(WaitStrategy(rix::util::Duration(1.0)));
+    EXPECT_TRUE(writer.wait_for_writable(rix::util::Duration(1.0)));
+    EXPECT_EQ(writer.wait_stats().spin_wins, 1);
+
+    reader.reset_wait_stats();
+    EXPECT_EQ(reader.wait_stats().spin_wins, 0);
+}
+
+TEST(WaitStrategyTest, FallsBackToBlocking) {
+    auto [reader, writer] = Pipe::create();
+    reader.set_wait_strategy(WaitStrategy(rix::util::Duration(0.001)));
+
+    std::thread sender([&writer]() {
+        rix::util::sleep_for(rix::util::Duration(0.05));
+        uint8_t byte = 1;
+        writer.write(&byte, 1);
+    });
+    EXPECT_TRUE(reader.wait_for_readable(rix::util::Duration::max()));
+    sender.join();
+    EXPECT_EQ(reader.wait_stats().spin_wins, 0);
+    EXPECT_EQ(reader.wait_stats().block_wins, 1);
+}
+
+TEST(WaitStrategyTest, TimeoutIncludesSpin) {
+    auto [reader, writer] = Pipe::create();
+    reader.set_wait_strategy(WaitStrategy(rix::util::Duration(0.02)));
+
+    rix::util::Timer timer;
+    timer.start();
+    EXPECT_FALSE(reader.wait_for_readable(rix::util::Duration(0.05)));
+    timer.stop();
+    EXPECT_NEAR(timer.get().to_milliseconds(), 50, 25);
+    EXPECT_EQ(reader.wait_stats().timeouts, 1);
+
+    // A spin budget longer than the timeout is cut short
+    reader.set_wait_strategy(WaitStrategy(rix::util::Duration(10.0)));
+    timer.start();
+    EXPECT_FALSE(reader.wait_for_readable(rix::util::Duration(0.01)));
+    timer.stop();
+    EXPECT_LT(timer.get().to_milliseconds(), 100);
+    EXPECT_EQ(reader.wait_stats().timeouts, 2);
+}
+
+TEST(WaitStrategyTest, SignalSpinsOnPendingCounter) {
+    Signal sig(SIGUSR1);
+    sig.set_wait_strategy(WaitStrategy(rix::util::Duration(1.0)));
+    EXPECT_EQ(sig.wait_strategy().spin(), rix::util::Duration(1.0));
+
+    pthread_t waiter = pthread_self();
+    std::thread sender([waiter]() {
+        rix::util::sleep_for(rix::util::Duration(0.001));
+        pthread_kill(waiter, SIGUSR1);
+    });
+    EXPECT_TRUE(sig.wait(rix::util::Duration(2.0)));
+    sender.join();
+    EXPECT_EQ(sig.info().signum, SIGUSR1);
+    EXPECT_EQ(sig.wait_stats().spin_wins, 1);
+
+    // The default strategy blocks
+    sig.set_wait_strategy(WaitStrategy());
+    sig.reset_wait_stats();
+    EXPECT_TRUE(sig.raise());
+    EXPECT_TRUE(sig.wait(rix::util::Duration(1.0)));
+    EXPECT_EQ(sig.wait_stats().block_wins, 1);
+    EXPECT_FALSE(sig.wait(rix::util::Duration(0)));
+    EXPECT_EQ(sig.wait_stats().timeouts, 1);
+
+    Signal moved(std::move(sig));
+    EXPECT_EQ(moved.wait_stats().block_wins, 1);
+}
@@ -0,0 +1,433 @@
+#!/usr/bin/env python3
+"""Generates the rix::msg message classes from .msg schema files.
+
+Each schema file msg/<package>/<Name>.msg declares one field per line as
+`<type> <name>`. A type is a primitive (bool, char, byte, int8..int64,
+uint8..uint64, float32, float64), `string`, or a message (`Name` in the same
+package or `package/Name`), optionally followed by `[N]` for a fixed-size array
+or `[]` for a vector. Text after `#` is a comment. A line
+`@hash <high> <low>` fixes the message hash to two 64-bit hex words, which
+keeps the hashes of messages that were published before the generator.
+
+For every schema, include/rix/msg/<package>/<Name>.hpp is written with:
+  - a `final` Message subclass, so calls through the concrete type are not
+    virtual,
+  - a STATIC_SIZE member when every field has a static size,
+  - packed serializers for runs of consecutive numbers,
+  - a read-only <Name>View over serialized buffers, and
+  - a 128-bit hash of the definition, including those of nested messages,
+    unless the schema fixes it with `@hash`.
+
+Usage:
+  msg_gen.py --out include msg/standard/Time.msg ...
+  msg_gen.py --out include --check msg/standard/Time.msg ...
+"""
+
+import argparse
+import hashlib
+import os
+import re
+import sys
+import textwrap
+
+PRIMITIVES = {
+    'bool': 'bool',
+    'char': 'char',
+    'byte': 'uint8_t',
+    'int8': 'int8_t',
+    'uint8': 'uint8_t',
+    'int16': 'int16_t',
+    'uint16': 'uint16_t',
+    'int32': 'int32_t',
+    'uint32': 'uint32_t',
+    'int64': 'int64_t',
+    'uint64': 'uint64_t',
+    'float32': 'float',
+    'float64': 'double',
+}
+
+SIZES = {
+    'bool': 1, 'char': 1, 'byte': 1, 'int8': 1, 'uint8': 1, 'int16': 2, 'uint16': 2,
+    'int32': 4, 'uint32': 4, 'int64': 8, 'uint64': 8, 'float32': 4, 'float64': 8,
+}
+
+HASH_RE = re.compile(r'^@hash\s+(0x[0-9a-fA-F]{1,16})\s+(0x[0-9a-fA-F]{1,16})$')
+FIELD_RE = re.compile(r'^([A-Za-z_][A-Za-z0-9_]*(?:/[A-Za-z_][A-Za-z0-9_]*)?)(\[(\d*)\])?\s+([A-Za-z_][A-Za-z0-9_]*)$')
+
+
+class Field:
+    def __init__(self, base, name, array, length):
+        self.base = base      # primitive name, 'string', or 'package/Name'
+        self.name = name
+        self.array = array    # None, 'array' or 'vector'
+        self.length = length  # element count of a fixed-size array
+
+    @property
+    def kind(self):
+        if self.base in PRIMITIVES:
+            return 'number'
+        if self.base == 'string':
+            return 'string'
+        return 'message'
+
+    def element_type(self):
+        if self.kind == 'number':
+            return PRIMITIVES[self.base]
+        if self.kind == 'string':
+            return 'std::string'
+        package, name = self.base.split('/')
+        return '%s::%s' % (package, name)
+
+    def cpp_type(self):
+        element = self.element_type()
+        if self.array == 'array':
+            return 'std::array<%s, %d>' % (element, self.length)
+        if self.array == 'vector':
+            return 'std::vector<%s>' % element
+        return element
+
+    def helper(self):
+        """Suffix of the detail:: helpers for this field."""
+        if self.array:
+            return '%s_%s' % (self.kind, self.array)
+        return self.kind
+
+
+class Schema:
+    def __init__(self, package, name, fields, source, hash_override=None):
+        self.package = package
+        self.name = name
+        self.fields = fields
+        self.source = source
+        self.hash_override = hash_override  # (high, low) from `@hash`, or None
+
+    @property
+    def full_name(self):
+        return '%s/%s' % (self.package, self.name)
+
+
+def parse(path):
+    package = os.path.basename(os.path.dirname(os.path.abspath(path)))
+    name = os.path.splitext(os.path.basename(path))[0]
+    fields = []
+    hash_override = None
+    with open(path) as f:
+        for number, line in enumerate(f, 1):
+            line = line.split('#', 1)[0].strip()
+            if not line:
+                continue
+            if line.startswith('@'):
+                match = HASH_RE.match(line)
+                if not match or hash_override is not None:
+                    sys.exit('%s:%d: cannot parse directive "%s"' % (path, number, line))
+                hash_override = (int(match.group(1), 16), int(match.group(2), 16))
+                continue
+            match = FIELD_RE.match(line)
+            if not match:
+                sys.exit('%s:%d: cannot parse field "%s"' % (path, number, line))
+            base, brackets, length, field_name = match.groups()
+            if base not in PRIMITIVES and base != 'string' and '/' not in base:
+                base = '%s/%s' % (package, base)
+            array = None
+            if brackets:
+                array = 'array' if length else 'vector'
+            fields.append(Field(base, field_name, array, int(length) if length else 0))
+    return Schema(package, name, fields, path, hash_override)
+
+
+class Generator:
+    def __init__(self, schemas):
+        self.schemas = {schema.full_name: schema for schema in schemas}
+        self.hashes = {}
+        self.static_sizes = {}
+        for schema in schemas:
+            for field in schema.fields:
+                if field.kind == 'message' and field.base not in self.schemas:
+                    sys.exit('%s: unknown message type "%s"' % (schema.source, field.base))
+
+    def static_size(self, full_name, visiting=()):
+        """Returns the serialized size in bytes if it is fixed, else None."""
+        if full_name in self.static_sizes:
+            return self.static_sizes[full_name]
+        if full_name in visiting:
+            sys.exit('%s: recursive message definition' % full_name)
+        total = 0
+        for field in self.schemas[full_name].fields:
+            if field.kind == 'string' or field.array == 'vector':
+                total = None
+                break
+            if field.kind == 'number':
+                element = SIZES[field.base]
+            else:
+                element = self.static_size(field.base, visiting + (full_name,))
+                if element is None:
+                    total = None
+                    break
+            total += element * (field.length if field.array == 'array' else 1)
+        self.static_sizes[full_name] = total
+        return total
+
+    def hash(self, full_name):
+        """MD5 of the definition, where nested messages contribute their hash."""
+        if full_name not in self.hashes and self.schemas[full_name].hash_override:
+            self.hashes[full_name] = self.schemas[full_name].hash_override
+        if full_name not in self.hashes:
+            lines = [full_name]
+            for field in self.schemas[full_name].fields:
+                base = field.base
+                if field.kind == 'message':
+                    base = '%016x%016x' % self.hash(field.base)
+                suffix = ''
+                if field.array == 'array':
+                    suffix = '[%d]' % field.length
+                elif field.array == 'vector':
+                    suffix = '[]'
+                lines.append('%s%s %s' % (base, suffix, field.name))
+            digest = hashlib.md5('\n'.join(lines).encode()).digest()
+            self.hashes[full_name] = (int.from_bytes(digest[:8], 'big'), int.from_bytes(digest[8:], 'big'))
+        return self.hashes[full_name]
+
+    def static_size_expr(self, field):
+        expr = 'static_size_v<%s>' % field.element_type()
+        if field.array == 'array':
+            return '%d * %s' % (field.length, expr)
+        return expr
+
+    @staticmethod
+    def packed_runs(fields):
+        """Groups consecutive scalar numbers so they are copied as one block."""
+        runs = []
+        for field in fields:
+            if field.kind == 'number' and not field.array and runs and isinstance(runs[-1], list):
+                runs[-1].append(field)
+            elif field.kind == 'number' and not field.array:
+                runs.append([field])
+            else:
+                runs.append(field)
+        return runs
+
+    def generate(self, full_name):
+        schema = self.schemas[full_name]
+        name = schema.name
+        static_size = self.static_size(full_name)
+        out = []
+        emit = out.append
+
+        emit('#pragma once')
+        emit('')
+        for header in ('cstdint', 'vector', 'array', 'map', 'string', 'cstring'):
+            emit('#include <%s>' % header)
+        emit('')
+        emit('#include "rix/msg/serialization.hpp"')
+        emit('#include "rix/msg/message.hpp"')
+        for dependency in sorted({f.base for f in schema.fields if f.kind == 'message'}):
+            emit('#include "rix/msg/%s.hpp"' % dependency)
+        emit('')
+        emit('namespace rix {')
+        emit('namespace msg {')
+        emit('namespace %s {' % schema.package)
+        emit('')
+
+        # Message
+        emit('class %s final : public Message {' % name)
+        emit('  public:')
+        for field in schema.fields:
+            emit('    %s %s{};' % (field.cpp_type(), field.name))
+        emit('')
+        emit('    %s() = default;' % name)
+        emit('    %s(const %s &other) = default;' % (name, name))
+        emit('    ~%s() = default;' % name)
+        emit('')
+        if static_size is not None:
+            emit('    static constexpr size_t STATIC_SIZE = %s;' %
+                 ' + '.join(self.static_size_expr(f) for f in schema.fields))
+            emit('')
+            emit('    size_t size() const override {')
+            emit('        return STATIC_SIZE;')
+            emit('    }')
+        else:
+            emit('    size_t size() const override {')
+            emit('        using namespace detail;')
+            emit('        size_t size = 0;')
+            for field in schema.fields:
+                emit('        size += size_%s(%s);' % (field.helper(), field.name))
+            emit('        return size;')
+            emit('    }')
+        emit('')
+        emit('    std::array<uint64_t, 2> hash() const override {')
+        emit('        return {0x%016xULL, 0x%016xULL};' % self.hash(full_name))
+        emit('    }')
+        emit('')
+        emit('    void serialize(uint8_t *dst, size_t &offset) const override {')
+        emit('        using namespace detail;')
+        for run in self.packed_runs(schema.fields):
+            if isinstance(run, list) and len(run) > 1:
+                emit('        serialize_numbers(dst, offset, %s);' % ', '.join(f.name for f in run))
+            else:
+                field = run[0] if isinstance(run, list) else run
+                emit('        serialize_%s(dst, offset, %s);' % (field.helper(), field.name))
+        emit('    }')
+        emit('')
+        emit('    bool deserialize(const uint8_t *src, size_t size, size_t &offset) override {')
+        emit('        using namespace detail;')
+        for run in self.packed_runs(schema.fields):
+            if isinstance(run, list) and len(run) > 1:
+                emit('        if (!deserialize_numbers(src, size, offset, %s)) { return false; };' %
+                     ', '.join(f.name for f in run))
+            else:
+                field = run[0] if isinstance(run, list) else run
+                emit('        if (!deserialize_%s(%s, src, size, offset)) { return false; };' %
+                     (field.helper(), field.name))
+        emit('        return true;')
+        emit('    }')
+        emit('};')
+        emit('')
+
+        out.extend(self.generate_view(schema, static_size))
+
+        emit('} // namespace %s' % schema.package)
+        emit('} // namespace msg')
+        emit('} // namespace rix')
+        return '\n'.join(out) + '\n'
+
+    def has_view(self, full_name):
+        """Views cover numbers, strings, messages and arrays or vectors of numbers."""
+        for field in self.schemas[full_name].fields:
+            if field.array and field.kind != 'number':
+                return False
+            if field.kind == 'message' and not self.has_view(field.base):
+                return False
+        return True
+
+    def generate_view(self, schema, static_size):
+        if not self.has_view(schema.full_name):
+            return []
+
+        name = schema.name
+        out = []
+        emit = out.append
+        strings = any(f.kind == 'string' for f in schema.fields)
+        if strings:
+            brief = ('@brief Read-only view of a serialized %s. Strings are returned as `std::string_view`s '
+                     'into the wrapped buffer, which must outlive the view.' % name)
+        else:
+            brief = ('@brief Read-only view of a serialized %s. The accessors read straight from the wrapped '
+                     'buffer, which must outlive the view.' % name)
+        emit('/**')
+        out.extend(textwrap.wrap(brief, 80, initial_indent=' * ', subsequent_indent=' * '))
+        emit(' */')
+        emit('class %sView {' % name)
+        emit('  public:')
+        emit('    %sView() = default;' % name)
+        emit('')
+
+        flat = static_size is not None and all(f.kind == 'number' and not f.array for f in schema.fields)
+        if flat:
+            # A fixed block of scalars is validated once and read at constant
+            # offsets
+            emit('    bool wrap(const uint8_t *src, size_t size, size_t &offset) {')
+            emit('        using namespace detail;')
+            emit('        return view_block(data_, %s::STATIC_SIZE, src, size, offset);' % name)
+            emit('    }')
+            emit('')
+            at = 0
+            for field in schema.fields:
+                pointer = 'data_' if at == 0 else 'data_ + %d' % at
+                emit('    %s %s() const { return detail::load_number<%s>(%s); }' %
+                     (field.element_type(), field.name, field.element_type(), pointer))
+                at += SIZES[field.base]
+            emit('')
+            emit('  private:')
+            emit('    const uint8_t *data_{};')
+            emit('};')
+            emit('')
+            return out
+
+        emit('    bool wrap(const uint8_t *src, size_t size, size_t &offset) {')
+        if any(f.kind != 'message' for f in schema.fields):
+            emit('        using namespace detail;')
+        for field in schema.fields:
+            if field.kind == 'message':
+                emit('        if (!%s_.wrap(src, size, offset)) { return false; };' % field.name)
+            elif field.kind == 'string':
+                emit('        if (!view_string(%s_, src, size, offset)) { return false; };' % field.name)
+            elif field.array == 'array':
+                emit('        if (!view_block(%s_, %s, src, size, offset)) { return false; };' %
+                     (field.name, self.static_size_expr(field)))
+            elif field.array == 'vector':
+                emit('        if (!deserialize_number(%s_size_, src, size, offset)) { return false; };' % field.name)
+                emit('        if (!view_block(%s_, %s_size_ * static_size_v<%s>, src, size, offset)) { return false; };' %
+                     (field.name, field.name, field.element_type()))
+            else:
+                emit('        if (!view_block(%s_, static_size_v<%s>, src, size, offset)) { return false; };' %
+                     (field.name, field.element_type()))
+        emit('        return true;')
+        emit('    }')
+        emit('')
+        for field in schema.fields:
+            element = field.element_type()
+            if field.kind == 'message':
+                emit('    const %sView &%s() const { return %s_; }' % (element, field.name, field.name))
+            elif field.kind == 'string':
+                emit('    std::string_view %s() const { return %s_; }' % (field.name, field.name))
+            elif field.array:
+                emit('    %s %s(size_t i) const { return detail::load_number<%s>(%s_ + i * sizeof(%s)); }' %
+                     (element, field.name, element, field.name, element))
+                length = '%d' % field.length if field.array == 'array' else '%s_size_' % field.name
+                emit('    size_t %s_size() const { return %s; }' % (field.name, length))
+            else:
+                emit('    %s %s() const { return detail::load_number<%s>(%s_); }' %
+                     (element, field.name, element, field.name))
+        emit('')
+        emit('  private:')
+        for field in schema.fields:
+            if field.kind == 'message':
+                emit('    %sView %s_{};' % (field.element_type(), field.name))
+            elif field.kind == 'string':
+                emit('    std::string_view %s_{};' % field.name)
+            else:
+                emit('    const uint8_t *%s_{};' % field.name)
+                if field.array == 'vector':
+                    emit('    uint32_t %s_size_{};' % field.name)
+        emit('};')
+        emit('')
+        return out
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Generate rix::msg classes from .msg schema files.')
+    parser.add_argument('--out', required=True, help='include directory that receives rix/msg/<package>/<Name>.hpp')
+    parser.add_argument('--check', action='store_true', help='fail if a generated file differs instead of writing it')
+    parser.add_argument('schemas', nargs='+', help='.msg schema files')
+    args = parser.parse_args()
+
+    schemas = [parse(path) for path in args.schemas]
+    generator = Generator(schemas)
+
+    stale = []
+    for schema in schemas:
+        path = os.path.join(args.out, 'rix', 'msg', schema.package, schema.name + '.hpp')
+        content = generator.generate(schema.full_name)
+        current = None
+        if os.path.exists(path):
+            with open(path) as f:
+                current = f.read()
+        if current == content:
+            continue
+        if args.check:
+            stale.append(path)
+            continue
+        # Unchanged files are not rewritten, so they are not rebuilt
+        os.makedirs(os.path.dirname(path), exist_ok=True)
+        with open(path, 'w') as f:
+            f.write(content)
+        print('Generated %s' % path)
+
+    if stale:
+        for path in stale:
+            print('Out of date: %s' % path, file=sys.stderr)
+        sys.exit(1)
+
+
+if __name__ == '__main__':
+    main()